@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace DSA {
@@ -14,13 +15,46 @@ constexpr bool VSYNC_ENABLED = true;
 constexpr std::size_t ARRAY_MAX_SIZE = 100;
 constexpr int ARRAY_MIN_VALUE = 1;
 constexpr int ARRAY_MAX_VALUE = 100;
+constexpr std::int64_t ARRAY_WIDE_MIN_VALUE = -1000000000000LL;
+constexpr std::int64_t ARRAY_WIDE_MAX_VALUE = 1000000000000LL;
+constexpr int PROJECTED_KEY_MIN = 1;
+constexpr int PROJECTED_KEY_MAX = 1000;
 constexpr std::size_t ARRAY_DEFAULT_SIZE = 10;
+constexpr const char* DATASET_FILE_PATH = "dataset.bin";
+constexpr const char* IMPORT_FILE_PATH = "dataset.csv";
+constexpr std::size_t IMPORT_PARALLEL_GRAIN_BYTES = 1024 * 1024;
+constexpr std::size_t STATS_MAX_ELEMENTS = 4096;
+
+constexpr std::uint64_t GENERATOR_DEFAULT_SEED = 42;
+constexpr std::size_t GENERATOR_PARALLEL_GRAIN = 64 * 1024;
+constexpr std::size_t GENERATOR_NEARLY_SORTED_SWAP_DIVISOR = 100;
+constexpr std::size_t GENERATOR_FEW_UNIQUE_VALUES = 8;
+constexpr std::size_t GENERATOR_SAWTOOTH_TEETH = 4;
+constexpr std::size_t GENERATOR_ZIPF_RANKS = 1024;
+constexpr double GENERATOR_ZIPF_EXPONENT = 1.0;
+
+constexpr std::size_t MERGE_PARALLEL_GRAIN = 64 * 1024;
+constexpr std::size_t MERGE_INSERTION_CUTOFF = 32;
 
 constexpr float ANIMATION_SWAP_DURATION_MS = 1200.0f;
 constexpr float ANIMATION_COMPARE_DURATION_MS = 800.0f;
 constexpr float ANIMATION_MIN_SPEED = 0.25f;
 constexpr float ANIMATION_MAX_SPEED = 4.0f;
 constexpr float ANIMATION_DEFAULT_SPEED = 0.5f;
+constexpr double TURBO_MIN_STEPS_PER_SECOND = 10.0;
+constexpr double TURBO_MAX_STEPS_PER_SECOND = 4000000.0;
+
+constexpr std::size_t TRACE_KEYFRAME_BUDGET_BYTES = 64 * 1024 * 1024;
+constexpr std::size_t TRACE_MIN_KEYFRAME_INTERVAL = 32;
+constexpr std::size_t TRACE_GENERATION_BATCH_STEPS = 4096;
+constexpr std::size_t TRACE_STEP_SEGMENT_SIZE = 1024;
+constexpr std::size_t TRACE_MEMORY_BUDGET_BYTES = 256 * 1024 * 1024;
+constexpr std::size_t TRACE_MIN_RESIDENT_SEGMENTS = 4;
+constexpr std::size_t TRACE_ARENA_INITIAL_BLOCK_BYTES = 64 * 1024;
+constexpr std::size_t TRACE_ARENA_MAX_BLOCK_BYTES = 16 * 1024 * 1024;
+constexpr const char* TRACE_FILE_PATH = "trace.dsatrace";
+constexpr std::size_t TRACE_CACHE_BUDGET_BYTES = 256 * 1024 * 1024;
+constexpr const char* TRACE_CACHE_DIRECTORY = "";
 
 constexpr const char* FONT_MAIN_PATH = "fonts/main.ttf";
 constexpr const char* FONT_MONOSPACE_PATH = "fonts/monospace.ttf";
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace DSA {
+
+class MappedFile {
+public:
+    enum class Access {
+        ReadOnly,
+        CopyOnWrite
+    };
+    
+    MappedFile();
+    explicit MappedFile(const std::string& path, Access access = Access::ReadOnly);
+    ~MappedFile();
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    
+    void open(const std::string& path, Access access = Access::ReadOnly);
+    void close() noexcept;
+    
+    bool isOpen() const noexcept { return m_open; }
+    const char* data() const noexcept { return m_data; }
+    char* mutableData() const noexcept { return m_access == Access::CopyOnWrite ? const_cast<char*>(m_data) : nullptr; }
+    Access getAccess() const noexcept { return m_access; }
+    std::size_t size() const noexcept { return m_size; }
+
+private:
+    const char* m_data;
+    std::size_t m_size;
+    Access m_access;
+    bool m_open;
+#ifdef _WIN32
+    void* m_fileHandle;
+    void* m_mappingHandle;
+#endif
+    
+    void takeFrom(MappedFile& other) noexcept;
+};
+
+}
@@ -0,0 +1,82 @@
+#include "SpillFile.h"
+#include <stdexcept>
+
+namespace DSA {
+
+SpillFile::SpillFile()
+    : m_file(nullptr)
+    , m_size(0)
+{
+}
+
+SpillFile::~SpillFile() {
+    close();
+}
+
+SpillFile::SpillFile(SpillFile&& other) noexcept
+    : m_file(other.m_file)
+    , m_size(other.m_size)
+{
+    other.m_file = nullptr;
+    other.m_size = 0;
+}
+
+SpillFile& SpillFile::operator=(SpillFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_file = other.m_file;
+        m_size = other.m_size;
+        other.m_file = nullptr;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+std::uint64_t SpillFile::append(const void* data, std::size_t bytes) {
+    if (!m_file) {
+        m_file = std::tmpfile();
+        if (!m_file) {
+            throw std::runtime_error("Failed to create spill file");
+        }
+    }
+    
+    std::uint64_t offset = m_size;
+    seek(offset);
+    if (std::fwrite(data, 1, bytes, m_file) != bytes) {
+        throw std::runtime_error("Failed to write spill file");
+    }
+    m_size += bytes;
+    return offset;
+}
+
+void SpillFile::read(std::uint64_t offset, void* data, std::size_t bytes) const {
+    if (!m_file || offset + bytes > m_size) {
+        throw std::out_of_range("Spill file read out of range");
+    }
+    
+    seek(offset);
+    if (std::fread(data, 1, bytes, m_file) != bytes) {
+        throw std::runtime_error("Failed to read spill file");
+    }
+}
+
+void SpillFile::close() noexcept {
+    if (m_file) {
+        std::fclose(m_file);
+    }
+    m_file = nullptr;
+    m_size = 0;
+}
+
+void SpillFile::seek(std::uint64_t offset) const {
+#ifdef _WIN32
+    int result = _fseeki64(m_file, static_cast<long long>(offset), SEEK_SET);
+#else
+    int result = fseeko(m_file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+    if (result != 0) {
+        throw std::runtime_error("Failed to seek spill file");
+    }
+}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace DSA {
+
+class SpillFile {
+public:
+    SpillFile();
+    ~SpillFile();
+    
+    SpillFile(const SpillFile&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+    
+    SpillFile(SpillFile&& other) noexcept;
+    SpillFile& operator=(SpillFile&& other) noexcept;
+    
+    std::uint64_t append(const void* data, std::size_t bytes);
+    void read(std::uint64_t offset, void* data, std::size_t bytes) const;
+    void close() noexcept;
+    
+    bool isOpen() const noexcept { return m_file != nullptr; }
+    std::uint64_t size() const noexcept { return m_size; }
+
+private:
+    std::FILE* m_file;
+    std::uint64_t m_size;
+    
+    void seek(std::uint64_t offset) const;
+};
+
+}
@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <memory>
+#include <string>
 #include "../../DSA/Algorithms/Sorting/SorterBase.h"
 
 namespace DSA {
@@ -44,12 +45,26 @@ public:
     
     
     std::unique_ptr<SorterBase> takeSelectedSorter();
+    
+    
+    void setSelectedTracePath(const std::string& path);
+    
+    
+    std::string takeSelectedTracePath();
+    
+    
+    void setSelectedDatasetPath(const std::string& path);
+    
+    
+    std::string takeSelectedDatasetPath();
 
 private:
     sf::RenderWindow& m_window;
     EventBus& m_eventBus;
     ResourceManager& m_resourceManager;
     std::unique_ptr<SorterBase> m_selectedSorter;
+    std::string m_selectedTracePath;
+    std::string m_selectedDatasetPath;
 };
 
 inline void StateContext::setSelectedSorter(std::unique_ptr<SorterBase> sorter) {
@@ -60,4 +75,24 @@ inline std::unique_ptr<SorterBase> StateContext::takeSelectedSorter() {
     return std::move(m_selectedSorter);
 }
 
+inline void StateContext::setSelectedTracePath(const std::string& path) {
+    m_selectedTracePath = path;
+}
+
+inline std::string StateContext::takeSelectedTracePath() {
+    std::string path = std::move(m_selectedTracePath);
+    m_selectedTracePath.clear();
+    return path;
+}
+
+inline void StateContext::setSelectedDatasetPath(const std::string& path) {
+    m_selectedDatasetPath = path;
+}
+
+inline std::string StateContext::takeSelectedDatasetPath() {
+    std::string path = std::move(m_selectedDatasetPath);
+    m_selectedDatasetPath.clear();
+    return path;
+}
+
 } 
@@ -1,32 +1,89 @@
 
 
 #include "AlgorithmExecutor.h"
+#include "Sorting/TraceFile.h"
 #include "../../App/Config.h"
+#include <cmath>
+#include <utility>
 
 namespace DSA {
 
 AlgorithmExecutor::AlgorithmExecutor()
     : m_sorter(nullptr)
     , m_array()
-    , m_steps()
+    , m_arrayHash(0)
+    , m_sourceGenerator()
+    , m_currentArray()
+    , m_currentAuxiliary()
+    , m_trace()
+    , m_traceKey()
+    , m_traceLoaded(false)
+    , m_loadedAlgorithmName()
+    , m_generator(nullptr)
+    , m_worker()
+    , m_stagingMutex()
+    , m_stagingCondition()
+    , m_stagedSteps()
+    , m_generationFinished(false)
+    , m_cancelRequested(false)
+    , m_generatedSteps(0)
     , m_currentStepIndex(0)
+    , m_currentStep()
     , m_state(State::Idle)
+    , m_reverse(false)
+    , m_keyframeBudget(Config::TRACE_KEYFRAME_BUDGET_BYTES)
+    , m_memoryBudget(Config::TRACE_MEMORY_BUDGET_BYTES)
     , m_speed(Config::ANIMATION_DEFAULT_SPEED)
+    , m_turbo(false)
+    , m_turboStepBudget(0.0)
     , m_timeSinceLastStep(0.0f)
     , m_stepDelay(0.5f)
 {
 }
 
+AlgorithmExecutor::~AlgorithmExecutor() {
+    retireTrace();
+    stopGeneration();
+}
+
 void AlgorithmExecutor::setSorter(std::unique_ptr<SorterBase> sorter) {
     m_sorter = std::move(sorter);
+    m_traceLoaded = false;
     reset();
 }
 
 void AlgorithmExecutor::setArray(const Array& array) {
     m_array = array;
+    m_arrayHash = TraceCache::hashInput(m_array);
+    m_sourceGenerator = nullptr;
+    m_traceLoaded = false;
     reset();
 }
 
+void AlgorithmExecutor::setArray(ArrayView array) {
+    m_array.assign(array);
+    m_arrayHash = TraceCache::hashInput(m_array);
+    m_sourceGenerator = nullptr;
+    m_traceLoaded = false;
+    reset();
+}
+
+void AlgorithmExecutor::setArray(Int64ArrayView array) {
+    setSource(array);
+}
+
+void AlgorithmExecutor::setArray(FloatArrayView array) {
+    setSource(array);
+}
+
+void AlgorithmExecutor::setArray(DoubleArrayView array) {
+    setSource(array);
+}
+
+void AlgorithmExecutor::setArray(RecordArrayView array) {
+    setSource(array);
+}
+
 bool AlgorithmExecutor::start() {
     if (m_state == State::Running) {
         return false;
@@ -38,28 +95,15 @@ bool AlgorithmExecutor::start() {
         return true;
     }
 
-    if (!m_sorter) {
+    if (!ensureTrace()) {
         return false;
     }
-    
-    if (m_array.isEmpty()) {
-        return false;
-    }
-
-    if (m_steps.empty()) {
-        m_steps = m_sorter->sort(m_array);
-        if (m_steps.empty()) {
-            return false;
-        }
-    }
 
-    m_currentStepIndex = 0;
+    rewind();
     m_state = State::Running;
+    m_reverse = false;
     m_timeSinceLastStep = 0.0f;
-
-    if (!m_steps.empty()) {
-        m_stepDelay = calculateStepDelay(m_steps[0]);
-    }
+    m_stepDelay = calculateStepDelay(m_trace[0]);
     
     return true;
 }
@@ -77,25 +121,153 @@ void AlgorithmExecutor::resume() {
 }
 
 void AlgorithmExecutor::reset() {
-    m_steps.clear();
+    retireTrace();
+    stopGeneration();
+    if (!m_traceLoaded) {
+        m_trace = SortTrace();
+    }
+    m_currentArray = m_array;
+    m_currentAuxiliary.clear();
     m_currentStepIndex = 0;
     m_state = State::Idle;
+    m_reverse = false;
     m_timeSinceLastStep = 0.0f;
+    m_turboStepBudget = 0.0;
 }
 
 void AlgorithmExecutor::stepForward() {
-    if (m_steps.empty()) {
+    if (m_trace.empty()) {
         return;
     }
     
-    if (m_currentStepIndex < m_steps.size() - 1) {
+    if (ensureStep(m_currentStepIndex + 1)) {
         advanceStep();
-    } else {
+    } else if (isTraceComplete()) {
 
         m_state = State::Completed;
     }
 }
 
+void AlgorithmExecutor::stepBackward() {
+    if (m_trace.empty() || m_currentStepIndex == 0) {
+        return;
+    }
+    
+    retreatStep();
+    if (m_state == State::Completed) {
+        m_state = State::Paused;
+    }
+}
+
+void AlgorithmExecutor::setReverse(bool reverse) {
+    m_reverse = reverse;
+    if (m_reverse && m_state == State::Completed) {
+        m_state = State::Paused;
+    }
+}
+
+void AlgorithmExecutor::seek(std::size_t stepIndex) {
+    if (!ensureTrace()) {
+        return;
+    }
+    
+    ensureStep(stepIndex);
+    if (stepIndex >= m_trace.size()) {
+        stepIndex = m_trace.size() - 1;
+    }
+    
+    moveTo(stepIndex);
+    
+    if (m_state == State::Idle || m_state == State::Completed) {
+        m_state = State::Paused;
+    }
+    m_timeSinceLastStep = 0.0f;
+    m_stepDelay = calculateStepDelay(m_trace[m_currentStepIndex]);
+}
+
+void AlgorithmExecutor::seekToProgress(float progress) {
+    if (!ensureTrace()) {
+        return;
+    }
+    
+    collectSteps(false);
+    
+    if (progress < 0.0f) {
+        progress = 0.0f;
+    } else if (progress > 1.0f) {
+        progress = 1.0f;
+    }
+    
+    float lastStep = static_cast<float>(m_trace.size() - 1);
+    seek(static_cast<std::size_t>(progress * lastStep + 0.5f));
+}
+
+bool AlgorithmExecutor::jumpToNext(TraceEvent event) {
+    if (!ensureTrace()) {
+        return false;
+    }
+    
+    collectSteps(false);
+    std::size_t position = m_trace.getIndex().next(event, m_currentStepIndex);
+    if (position == TraceIndex::NOT_FOUND) {
+        return false;
+    }
+    
+    seek(position);
+    return true;
+}
+
+bool AlgorithmExecutor::jumpToPrevious(TraceEvent event) {
+    if (!ensureTrace()) {
+        return false;
+    }
+    
+    std::size_t position = m_trace.getIndex().previous(event, m_currentStepIndex);
+    if (position == TraceIndex::NOT_FOUND) {
+        return false;
+    }
+    
+    seek(position);
+    return true;
+}
+
+void AlgorithmExecutor::setKeyframeBudget(std::size_t budgetBytes) {
+    m_keyframeBudget = budgetBytes;
+    m_trace.setKeyframeBudget(m_keyframeBudget);
+}
+
+void AlgorithmExecutor::setMemoryBudget(std::size_t budgetBytes) {
+    m_memoryBudget = budgetBytes;
+    m_trace.setMemoryBudget(m_memoryBudget);
+}
+
+bool AlgorithmExecutor::saveTrace(const std::string& path) const {
+    if (m_trace.empty() || !isTraceComplete()) {
+        return false;
+    }
+    
+    TraceFile::write(path, m_trace, getAlgorithmName());
+    return true;
+}
+
+void AlgorithmExecutor::loadTrace(const std::string& path) {
+    retireTrace();
+    stopGeneration();
+    
+    std::string algorithmName;
+    SortTrace trace = TraceFile::open(path, algorithmName);
+    trace.setKeyframeBudget(m_keyframeBudget);
+    
+    m_trace = std::move(trace);
+    m_traceKey = TraceCache::Key();
+    m_loadedAlgorithmName = algorithmName;
+    m_array = m_trace.getInitialState();
+    m_arrayHash = TraceCache::hashInput(m_array);
+    m_sourceGenerator = nullptr;
+    m_traceLoaded = true;
+    reset();
+}
+
 void AlgorithmExecutor::setSpeed(float speed) {
 
     if (speed < Config::ANIMATION_MIN_SPEED) {
@@ -107,46 +279,86 @@ void AlgorithmExecutor::setSpeed(float speed) {
     }
 }
 
+void AlgorithmExecutor::setTurbo(bool turbo) {
+    m_turbo = turbo;
+    m_turboStepBudget = 0.0;
+    m_timeSinceLastStep = 0.0f;
+}
+
+double AlgorithmExecutor::getStepsPerSecond() const {
+    if (!m_turbo) {
+        return m_speed / m_stepDelay;
+    }
+    
+    double position = (m_speed - Config::ANIMATION_MIN_SPEED) /
+                      (Config::ANIMATION_MAX_SPEED - Config::ANIMATION_MIN_SPEED);
+    return Config::TURBO_MIN_STEPS_PER_SECOND *
+           std::pow(Config::TURBO_MAX_STEPS_PER_SECOND / Config::TURBO_MIN_STEPS_PER_SECOND, position);
+}
+
 void AlgorithmExecutor::update(float deltaTime) {
     if (m_state != State::Running) {
         return;
     }
     
-    if (m_steps.empty()) {
+    if (m_trace.empty()) {
         m_state = State::Completed;
         return;
     }
 
+    collectSteps(false);
+    
+    if (m_turbo) {
+        updateTurbo(deltaTime);
+        return;
+    }
+    
     m_timeSinceLastStep += deltaTime;
 
     float requiredDelay = m_stepDelay / m_speed;
     if (m_timeSinceLastStep >= requiredDelay) {
-        advanceStep();
+        if (m_reverse) {
+            retreatStep();
+        } else {
+            advanceStep();
+        }
         m_timeSinceLastStep = 0.0f;
 
-        if (m_currentStepIndex < m_steps.size()) {
-            m_stepDelay = calculateStepDelay(m_steps[m_currentStepIndex]);
+        if (m_currentStepIndex < m_trace.size()) {
+            m_stepDelay = calculateStepDelay(m_trace[m_currentStepIndex]);
         }
     }
 }
 
 const SortStep* AlgorithmExecutor::getCurrentStep() const {
-    if (m_steps.empty() || m_currentStepIndex >= m_steps.size()) {
+    if (m_trace.empty() || m_currentStepIndex >= m_trace.size()) {
         return nullptr;
     }
     
-    return &m_steps[m_currentStepIndex];
+    m_currentStep = m_trace[m_currentStepIndex];
+    return &m_currentStep;
+}
+
+float AlgorithmExecutor::getProgress() const {
+    if (m_trace.size() <= 1) {
+        return 0.0f;
+    }
+    
+    return static_cast<float>(m_currentStepIndex) / static_cast<float>(m_trace.size() - 1);
 }
 
 std::string AlgorithmExecutor::getCurrentMessage() const {
     const SortStep* step = getCurrentStep();
     if (step) {
-        return step->message;
+        return formatMessage(step->message);
     }
     return "";
 }
 
 std::string AlgorithmExecutor::getAlgorithmName() const {
+    if (m_traceLoaded) {
+        return m_loadedAlgorithmName;
+    }
     if (m_sorter) {
         return m_sorter->getName();
     }
@@ -154,14 +366,254 @@ std::string AlgorithmExecutor::getAlgorithmName() const {
 }
 
 void AlgorithmExecutor::advanceStep() {
-    if (m_currentStepIndex < m_steps.size() - 1) {
+    if (ensureStep(m_currentStepIndex + 1)) {
         ++m_currentStepIndex;
+        SortTrace::applyDelta(m_currentArray, m_currentAuxiliary, m_trace.deltaAt(m_currentStepIndex));
+    } else if (isTraceComplete()) {
+
+        m_state = State::Completed;
+    }
+}
+
+bool AlgorithmExecutor::ensureTrace() {
+    if (!m_trace.empty()) {
+        return true;
+    }
+    
+    if (!m_sorter || m_array.isEmpty()) {
+        return false;
+    }
+    
+    if (!m_worker.joinable()) {
+        m_traceKey = TraceCache::makeKey(m_sorter->getName(), m_arrayHash, m_array.size());
+        if (!TraceCache::getInstance().take(m_traceKey, m_array, m_trace)) {
+            m_trace = SortTrace(m_array, m_sorter->getAuxiliarySize(m_array.size()));
+            startGeneration();
+        }
+        m_trace.setKeyframeBudget(m_keyframeBudget);
+        m_trace.setMemoryBudget(m_memoryBudget);
+    }
+    
+    while (m_trace.empty() && m_worker.joinable()) {
+        collectSteps(true);
+    }
+    
+    if (m_trace.empty()) {
+        return false;
+    }
+    
+    rewind();
+    return true;
+}
+
+void AlgorithmExecutor::retireTrace() {
+    if (m_worker.joinable() && isGenerationFinished()) {
+        collectSteps(true);
+    }
+    
+    if (!m_traceKey.isValid() || m_trace.empty() || !isTraceComplete()) {
+        return;
+    }
+    
+    TraceCache::getInstance().store(m_traceKey, std::move(m_trace));
+    m_trace = SortTrace();
+    m_traceKey = TraceCache::Key();
+}
+
+bool AlgorithmExecutor::ensureStep(std::size_t stepIndex) {
+    if (stepIndex >= m_trace.size()) {
+        collectSteps(false);
+    }
+    return stepIndex < m_trace.size();
+}
+
+void AlgorithmExecutor::startGeneration() {
+    m_generator = m_sourceGenerator ? m_sourceGenerator(*m_sorter) : m_sorter->createGenerator(m_array);
+    m_stagedSteps.clear();
+    m_generationFinished = false;
+    m_cancelRequested.store(false);
+    m_generatedSteps.store(0);
+    
+    m_worker = std::thread(&AlgorithmExecutor::generateSteps, this);
+}
+
+template <typename T>
+void AlgorithmExecutor::setSource(BasicArrayView<T> source) {
+    KeyProjection projection = KeyProjection::fit(source.data(), source.size());
+    BasicArray<T> values(source);
+    
+    Array display(source.size());
+    int* projected = display.data();
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        projected[i] = projection(source[i]);
+    }
+    
+    m_array = std::move(display);
+    m_arrayHash = TraceCache::hashInput(source.data(), source.size() * sizeof(T));
+    m_sourceGenerator = [values, projection](const SorterBase& sorter) {
+        return sorter.createGenerator(values.view(), projection);
+    };
+    m_traceLoaded = false;
+    reset();
+}
+
+void AlgorithmExecutor::stopGeneration() {
+    if (m_worker.joinable()) {
+        m_cancelRequested.store(true);
+        m_worker.join();
+    }
+    
+    m_generator.reset();
+    m_stagedSteps.clear();
+    m_generationFinished = false;
+}
+
+void AlgorithmExecutor::generateSteps() {
+    std::vector<SortStep> batch;
+    std::size_t batchLimit = 1;
+    SortStep step;
+    
+    while (!m_cancelRequested.load(std::memory_order_relaxed) && m_generator->next(step)) {
+        batch.push_back(std::move(step));
+        m_generatedSteps.fetch_add(1, std::memory_order_relaxed);
+        
+        if (batch.size() >= batchLimit) {
+            publishSteps(batch);
+            if (batchLimit < Config::TRACE_GENERATION_BATCH_STEPS) {
+                batchLimit *= 2;
+            }
+        }
+    }
+    
+    publishSteps(batch);
+    {
+        std::lock_guard<std::mutex> lock(m_stagingMutex);
+        m_generationFinished = true;
+    }
+    m_stagingCondition.notify_all();
+}
+
+void AlgorithmExecutor::publishSteps(std::vector<SortStep>& batch) {
+    if (batch.empty()) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_stagingMutex);
+        if (m_stagedSteps.empty()) {
+            m_stagedSteps.swap(batch);
+        } else {
+            for (SortStep& step : batch) {
+                m_stagedSteps.push_back(std::move(step));
+            }
+        }
+    }
+    batch.clear();
+    m_stagingCondition.notify_all();
+}
+
+void AlgorithmExecutor::collectSteps(bool wait) {
+    if (!m_worker.joinable()) {
+        return;
+    }
+    
+    std::vector<SortStep> steps;
+    bool finished = false;
+    {
+        std::unique_lock<std::mutex> lock(m_stagingMutex, std::defer_lock);
+        if (wait) {
+            lock.lock();
+            m_stagingCondition.wait(lock, [this]() {
+                return !m_stagedSteps.empty() || m_generationFinished;
+            });
+        } else if (!lock.try_lock()) {
+            return;
+        }
+        
+        steps.swap(m_stagedSteps);
+        finished = m_generationFinished;
+    }
+    
+    for (SortStep& step : steps) {
+        m_trace.push(std::move(step));
+    }
+    
+    if (finished) {
+        m_worker.join();
+        m_generator.reset();
+    }
+}
+
+bool AlgorithmExecutor::isGenerationFinished() {
+    std::lock_guard<std::mutex> lock(m_stagingMutex);
+    return m_generationFinished;
+}
+
+void AlgorithmExecutor::retreatStep() {
+    if (m_currentStepIndex > 0) {
+        SortTrace::revertDelta(m_currentArray, m_currentAuxiliary, m_trace.deltaAt(m_currentStepIndex));
+        --m_currentStepIndex;
+    } else {
+
+        m_state = State::Paused;
+    }
+}
+
+void AlgorithmExecutor::moveTo(std::size_t stepIndex) {
+    std::size_t interval = m_trace.getKeyframeInterval();
+    if (stepIndex >= m_currentStepIndex && stepIndex - m_currentStepIndex <= interval) {
+        while (m_currentStepIndex < stepIndex) {
+            ++m_currentStepIndex;
+            SortTrace::applyDelta(m_currentArray, m_currentAuxiliary, m_trace.deltaAt(m_currentStepIndex));
+        }
+    } else if (stepIndex < m_currentStepIndex && m_currentStepIndex - stepIndex <= interval) {
+        while (m_currentStepIndex > stepIndex) {
+            SortTrace::revertDelta(m_currentArray, m_currentAuxiliary, m_trace.deltaAt(m_currentStepIndex));
+            --m_currentStepIndex;
+        }
     } else {
+        m_trace.restoreState(stepIndex, m_currentArray, m_currentAuxiliary);
+        m_currentStepIndex = stepIndex;
+    }
+}
 
+void AlgorithmExecutor::updateTurbo(float deltaTime) {
+    m_turboStepBudget += deltaTime * getStepsPerSecond();
+    if (m_turboStepBudget < 1.0) {
+        return;
+    }
+    
+    double wholeSteps = std::floor(m_turboStepBudget);
+    m_turboStepBudget -= wholeSteps;
+    std::size_t stepCount = wholeSteps < static_cast<double>(m_trace.size())
+        ? static_cast<std::size_t>(wholeSteps) : m_trace.size();
+    
+    if (m_reverse) {
+        moveTo(stepCount < m_currentStepIndex ? m_currentStepIndex - stepCount : 0);
+        if (m_currentStepIndex == 0) {
+            m_state = State::Paused;
+        }
+        return;
+    }
+    
+    std::size_t lastStep = m_trace.size() - 1;
+    std::size_t remaining = lastStep - m_currentStepIndex;
+    moveTo(stepCount < remaining ? m_currentStepIndex + stepCount : lastStep);
+    if (m_currentStepIndex == lastStep && isTraceComplete()) {
         m_state = State::Completed;
     }
 }
 
+void AlgorithmExecutor::rewind() {
+    m_currentArray = m_trace.getInitialState();
+    m_currentAuxiliary.clear();
+    m_currentAuxiliary.resize(m_trace.getAuxiliarySize());
+    m_currentStepIndex = 0;
+    if (!m_trace.empty()) {
+        SortTrace::applyDelta(m_currentArray, m_currentAuxiliary, m_trace.deltaAt(0));
+    }
+}
+
 float AlgorithmExecutor::calculateStepDelay(const SortStep& step) const {
 
     switch (step.type) {
@@ -4,10 +4,18 @@
 
 #include "Sorting/SorterBase.h"
 #include "Sorting/SortStep.h"
+#include "Sorting/SortTrace.h"
+#include "Sorting/TraceCache.h"
 #include "../Array/Array.h"
 #include <vector>
 #include <memory>
+#include <string>
 #include <cstddef>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 
 namespace DSA {
 
@@ -26,7 +34,7 @@ public:
     AlgorithmExecutor();
     
     
-    ~AlgorithmExecutor() = default;
+    ~AlgorithmExecutor();
     
     
     void setSorter(std::unique_ptr<SorterBase> sorter);
@@ -35,6 +43,21 @@ public:
     void setArray(const Array& array);
     
     
+    void setArray(ArrayView array);
+    
+    
+    void setArray(Int64ArrayView array);
+    
+    
+    void setArray(FloatArrayView array);
+    
+    
+    void setArray(DoubleArrayView array);
+    
+    
+    void setArray(RecordArrayView array);
+    
+    
     bool start();
     
     
@@ -50,9 +73,57 @@ public:
     void stepForward();
     
     
+    void stepBackward();
+    
+    
+    void setReverse(bool reverse);
+    
+    
+    bool isReverse() const { return m_reverse; }
+    
+    
+    void seek(std::size_t stepIndex);
+    
+    
+    void seekToProgress(float progress);
+    
+    
+    bool jumpToNext(TraceEvent event);
+    
+    
+    bool jumpToPrevious(TraceEvent event);
+    
+    
+    void setKeyframeBudget(std::size_t budgetBytes);
+    
+    
+    void setMemoryBudget(std::size_t budgetBytes);
+    
+    
+    std::size_t getMemoryBudget() const { return m_memoryBudget; }
+    
+    
+    bool saveTrace(const std::string& path) const;
+    
+    
+    void loadTrace(const std::string& path);
+    
+    
+    bool isTraceLoaded() const { return m_traceLoaded; }
+    
+    
     void setSpeed(float speed);
     
     
+    void setTurbo(bool turbo);
+    
+    
+    bool isTurbo() const { return m_turbo; }
+    
+    
+    double getStepsPerSecond() const;
+    
+    
     void update(float deltaTime);
     
     
@@ -62,7 +133,25 @@ public:
     std::size_t getCurrentStepIndex() const { return m_currentStepIndex; }
     
     
-    std::size_t getTotalSteps() const { return m_steps.size(); }
+    std::size_t getTotalSteps() const { return m_trace.size(); }
+    
+    
+    bool isTraceComplete() const { return !m_worker.joinable(); }
+    
+    
+    std::size_t getGeneratedSteps() const { return m_generatedSteps.load(std::memory_order_relaxed); }
+    
+    
+    float getProgress() const;
+    
+    
+    const Array& getCurrentArray() const { return m_currentArray; }
+    
+    
+    ArrayView getCurrentView() const noexcept { return m_currentArray.view(); }
+    
+    
+    ArrayView getAuxiliaryView() const noexcept { return m_currentAuxiliary.view(); }
     
     
     bool isCompleted() const { return m_state == State::Completed; }
@@ -79,11 +168,35 @@ public:
 private:
     std::unique_ptr<SorterBase> m_sorter;
     Array m_array;
-    std::vector<SortStep> m_steps;
+    std::uint64_t m_arrayHash;
+    std::function<std::unique_ptr<StepGenerator>(const SorterBase&)> m_sourceGenerator;
+    Array m_currentArray;
+    Array m_currentAuxiliary;
+    SortTrace m_trace;
+    TraceCache::Key m_traceKey;
+    bool m_traceLoaded;
+    std::string m_loadedAlgorithmName;
+    std::unique_ptr<StepGenerator> m_generator;
+    
+    std::thread m_worker;
+    std::mutex m_stagingMutex;
+    std::condition_variable m_stagingCondition;
+    std::vector<SortStep> m_stagedSteps;
+    bool m_generationFinished;
+    std::atomic<bool> m_cancelRequested;
+    std::atomic<std::size_t> m_generatedSteps;
+    
     std::size_t m_currentStepIndex;
+    mutable SortStep m_currentStep;
     State m_state;
+    bool m_reverse;
+    
+    std::size_t m_keyframeBudget;
+    std::size_t m_memoryBudget;
     
     float m_speed;
+    bool m_turbo;
+    double m_turboStepBudget;
     float m_timeSinceLastStep;
     float m_stepDelay;
     
@@ -91,6 +204,49 @@ private:
     void advanceStep();
     
     
+    void retreatStep();
+    
+    
+    void moveTo(std::size_t stepIndex);
+    
+    
+    void updateTurbo(float deltaTime);
+    
+    
+    void rewind();
+    
+    
+    bool ensureTrace();
+    
+    
+    void retireTrace();
+    
+    
+    bool ensureStep(std::size_t stepIndex);
+    
+    
+    void startGeneration();
+    
+    
+    template <typename T>
+    void setSource(BasicArrayView<T> source);
+    
+    
+    void stopGeneration();
+    
+    
+    void generateSteps();
+    
+    
+    void publishSteps(std::vector<SortStep>& batch);
+    
+    
+    void collectSteps(bool wait);
+    
+    
+    bool isGenerationFinished();
+    
+    
     float calculateStepDelay(const SortStep& step) const;
 };
 
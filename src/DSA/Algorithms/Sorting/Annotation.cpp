@@ -0,0 +1,38 @@
+#include "Annotation.h"
+
+namespace DSA {
+
+AnnotationRegistry& AnnotationRegistry::getInstance() {
+    static AnnotationRegistry instance;
+    return instance;
+}
+
+AnnotationRegistry::AnnotationRegistry()
+    : m_names{"", "key", "minimum", "maximum"}
+{
+}
+
+AnnotationKey AnnotationRegistry::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    for (std::size_t i = 1; i < m_names.size(); ++i) {
+        if (m_names[i] == name) {
+            return static_cast<AnnotationKey>(i);
+        }
+    }
+    
+    if (m_names.size() > UINT16_MAX) {
+        throw std::length_error("Too many annotation keys");
+    }
+    m_names.push_back(name);
+    return static_cast<AnnotationKey>(m_names.size() - 1);
+}
+
+std::string AnnotationRegistry::getName(AnnotationKey key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    std::size_t index = static_cast<std::size_t>(key);
+    return index < m_names.size() ? m_names[index] : "";
+}
+
+}
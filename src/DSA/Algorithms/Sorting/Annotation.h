@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <stdexcept>
+
+namespace DSA {
+
+enum class AnnotationKey : std::uint16_t {
+    None = 0,
+    Key,
+    Minimum,
+    Maximum,
+    FirstCustom
+};
+
+class AnnotationRegistry {
+public:
+    static AnnotationRegistry& getInstance();
+    
+    AnnotationKey intern(const std::string& name);
+    std::string getName(AnnotationKey key) const;
+
+private:
+    AnnotationRegistry();
+    AnnotationRegistry(const AnnotationRegistry&) = delete;
+    AnnotationRegistry& operator=(const AnnotationRegistry&) = delete;
+    
+    mutable std::mutex m_mutex;
+    std::vector<std::string> m_names;
+};
+
+class AnnotationSet {
+public:
+    static constexpr std::size_t INLINE_CAPACITY = 2;
+    
+    struct Entry {
+        AnnotationKey key;
+        std::uint8_t padding[alignof(std::int64_t) - sizeof(AnnotationKey)] = {};
+        std::int64_t value;
+    };
+    
+    AnnotationSet()
+        : m_entries()
+        , m_count(0)
+        , m_padding()
+    {}
+    
+    void set(AnnotationKey key, std::int64_t value) {
+        for (std::uint8_t i = 0; i < m_count; ++i) {
+            if (m_entries[i].key == key) {
+                m_entries[i].value = value;
+                return;
+            }
+        }
+        
+        if (m_count == INLINE_CAPACITY) {
+            throw std::length_error("AnnotationSet inline capacity exceeded");
+        }
+        m_entries[m_count++] = Entry{key, {}, value};
+    }
+    
+    const Entry* find(AnnotationKey key) const {
+        for (std::uint8_t i = 0; i < m_count; ++i) {
+            if (m_entries[i].key == key) {
+                return &m_entries[i];
+            }
+        }
+        return nullptr;
+    }
+    
+    bool empty() const noexcept { return m_count == 0; }
+    std::size_t size() const noexcept { return m_count; }
+    
+    const Entry* begin() const noexcept { return m_entries; }
+    const Entry* end() const noexcept { return m_entries + m_count; }
+    
+    void clear() noexcept { m_count = 0; }
+
+private:
+    Entry m_entries[INLINE_CAPACITY];
+    std::uint8_t m_count;
+    std::uint8_t m_padding[alignof(std::int64_t) - 1];
+};
+
+}
@@ -0,0 +1,68 @@
+#include "BottomUpMergeSort.h"
+#include "../../Array/Array.h"
+#include <algorithm>
+#include <utility>
+
+namespace DSA {
+
+template <typename T>
+BottomUpMergeSortAlgorithm<T>::BottomUpMergeSortAlgorithm(BasicArray<T> array)
+    : MergeSortAlgorithm<T>(std::move(array))
+    , m_width(1)
+    , m_begin(0)
+{
+}
+
+template <typename T>
+template <typename Recorder>
+void BottomUpMergeSortAlgorithm<T>::produce(Recorder& recorder) {
+    if (this->isMerging()) {
+        this->produceMerge(recorder);
+        return;
+    }
+    
+    std::size_t size = this->m_size;
+    if (m_width >= size) {
+        this->produceCompletion(recorder);
+        return;
+    }
+    
+    if (size - m_begin > m_width) {
+        std::size_t middle = m_begin + m_width;
+        std::size_t end = middle + std::min(m_width, size - middle);
+        this->beginMerge(MergeRange{m_begin, middle, end});
+        m_begin = end;
+        this->produceMerge(recorder);
+        return;
+    }
+    
+    recorder.record(SortEvent::None, [&]() {
+        return SortAlgorithm::createHighlightStep({},
+            StepMessage(MessageID::MergeWidthComplete, m_width));
+    });
+    
+    m_width *= 2;
+    m_begin = 0;
+}
+
+template <typename T>
+template <typename Recorder>
+void BottomUpMergeSortAlgorithm<T>::run(Recorder& recorder) {
+    while (!this->isFinished()) {
+        produce(recorder);
+    }
+}
+
+DSA_INSTANTIATE_SORT_ALGORITHM(BottomUpMergeSortAlgorithm, int);
+DSA_INSTANTIATE_SORT_ALGORITHM(BottomUpMergeSortAlgorithm, std::int64_t);
+DSA_INSTANTIATE_SORT_ALGORITHM(BottomUpMergeSortAlgorithm, float);
+DSA_INSTANTIATE_SORT_ALGORITHM(BottomUpMergeSortAlgorithm, double);
+DSA_INSTANTIATE_SORT_ALGORITHM(BottomUpMergeSortAlgorithm, KeyedRecord);
+
+std::string BottomUpMergeSort::getDescription() const {
+    return "Bottom-Up Merge Sort starts from single elements and repeatedly merges "
+           "neighbouring runs of width 1, 2, 4 and so on until one run remains. "
+           "It needs no recursion but still copies through an O(n) auxiliary buffer.";
+}
+
+}
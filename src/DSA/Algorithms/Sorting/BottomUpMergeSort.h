@@ -0,0 +1,46 @@
+#pragma once
+
+#include "MergeSort.h"
+
+namespace DSA {
+
+
+template <typename T>
+class BottomUpMergeSortAlgorithm : public MergeSortAlgorithm<T> {
+public:
+    
+    explicit BottomUpMergeSortAlgorithm(BasicArray<T> array);
+    
+    
+    template <typename Recorder>
+    void produce(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void run(Recorder& recorder);
+
+private:
+    
+    using MergeRange = typename MergeSortAlgorithm<T>::MergeRange;
+    
+    std::size_t m_width;
+    std::size_t m_begin;
+};
+
+
+class BottomUpMergeSort : public MergeSorter<BottomUpMergeSortAlgorithm> {
+public:
+    
+    BottomUpMergeSort() = default;
+    
+    
+    virtual ~BottomUpMergeSort() = default;
+    
+    
+    std::string getName() const override { return "Bottom-Up Merge Sort"; }
+    
+    
+    std::string getDescription() const override;
+};
+
+}
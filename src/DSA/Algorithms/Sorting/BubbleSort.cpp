@@ -1,68 +1,91 @@
 #include "BubbleSort.h"
 #include "../../Array/Array.h"
-#include <sstream>
-#include <iomanip>
+#include <utility>
 
 namespace DSA {
 
-std::vector<SortStep> BubbleSort::sort(const Array& array) {
-    std::vector<SortStep> steps;
+template <typename T>
+BubbleSortAlgorithm<T>::BubbleSortAlgorithm(BasicArray<T> array)
+    : SortAlgorithm()
+    , m_array(std::move(array))
+    , m_size(m_array.size())
+    , m_pass(0)
+    , m_index(0)
+    , m_swapped(false)
+{
+}
 
-    if (array.size() <= 1) {
-        if (array.size() == 1) {
-            steps.push_back(createCompleteStep(array));
+template <typename T>
+template <typename Recorder>
+void BubbleSortAlgorithm<T>::produce(Recorder& recorder) {
+    const BasicArray<T>& values = m_array;
+    
+    if (m_size <= 1 || m_pass >= m_size - 1) {
+        if (m_size > 0) {
+            recorder.record(SortEvent::None, [&]() { return createCompleteStep(); });
         }
-        return steps;
+        finish();
+        return;
     }
-
-    Array workingArray = array;
     
-    std::size_t n = workingArray.size();
-    bool swapped;
-
-    for (std::size_t pass = 0; pass < n - 1; ++pass) {
-        swapped = false;
+    if (m_index < m_size - 1 - m_pass) {
+        std::size_t i = m_index;
+        std::size_t j = i + 1;
         
-        for (std::size_t i = 0; i < n - 1 - pass; ++i) {
-            std::size_t j = i + 1;
-            
-            std::ostringstream msg;
-            msg << "Comparing elements at indices " << i << " and " << j 
-                << " (values: " << workingArray[i] << " and " << workingArray[j] << ")";
-            
-            std::vector<std::size_t> compareIndices = {i, j};
-            steps.push_back(createCompareStep(workingArray, compareIndices, msg.str()));
-            
-            if (workingArray[i] > workingArray[j]) {
-                std::ostringstream swapMsg;
-                swapMsg << "Swapping elements at indices " << i << " and " << j 
-                        << " (" << workingArray[i] << " > " << workingArray[j] << ")";
-                
-                steps.push_back(createSwapStep(workingArray, i, j, swapMsg.str()));
-                
-                workingArray.swap(i, j);
-                swapped = true;
-            }
-        }
+        recorder.record(SortEvent::Compare, [&]() {
+            IndexList compareIndices = {i, j};
+            return createCompareStep(compareIndices,
+                StepMessage(MessageID::CompareAdjacent, i, j, displayValue(values[i]), displayValue(values[j])));
+        });
         
-        if (!swapped) {
-            break;
+        if (values[i] > values[j]) {
+            recorder.record(SortEvent::Swap, [&]() {
+                return createSwapStep(i, j,
+                    StepMessage(MessageID::SwapAdjacent, i, j, displayValue(values[i]), displayValue(values[j])));
+            });
+            
+            m_array.swap(i, j);
+            m_swapped = true;
         }
         
-        std::size_t lastIndex = n - 1 - pass;
-        std::ostringstream highlightMsg;
-        highlightMsg << "Pass " << (pass + 1) << " complete. Element at index " 
-                     << lastIndex << " is in its final position.";
-        
-        std::vector<std::size_t> highlightIndices = {lastIndex};
-        steps.push_back(createHighlightStep(workingArray, highlightIndices, highlightMsg.str()));
+        ++m_index;
+        return;
     }
-
-    steps.push_back(createCompleteStep(workingArray));
     
-    return steps;
+    if (!m_swapped) {
+        recorder.record(SortEvent::Pass, [&]() { return createCompleteStep(); });
+        finish();
+        return;
+    }
+    
+    std::size_t lastIndex = m_size - 1 - m_pass;
+    recorder.record(SortEvent::Pass, [&]() {
+        IndexList highlightIndices = {lastIndex};
+        RoleSet sortedRoles;
+        sortedRoles.setRange(lastIndex, m_size, ElementRole::Sorted);
+        return createHighlightStep(highlightIndices, sortedRoles,
+            StepMessage(MessageID::PassComplete, m_pass + 1, lastIndex));
+    });
+    
+    ++m_pass;
+    m_index = 0;
+    m_swapped = false;
 }
 
+template <typename T>
+template <typename Recorder>
+void BubbleSortAlgorithm<T>::run(Recorder& recorder) {
+    while (!isFinished()) {
+        produce(recorder);
+    }
+}
+
+DSA_INSTANTIATE_SORT_ALGORITHM(BubbleSortAlgorithm, int);
+DSA_INSTANTIATE_SORT_ALGORITHM(BubbleSortAlgorithm, std::int64_t);
+DSA_INSTANTIATE_SORT_ALGORITHM(BubbleSortAlgorithm, float);
+DSA_INSTANTIATE_SORT_ALGORITHM(BubbleSortAlgorithm, double);
+DSA_INSTANTIATE_SORT_ALGORITHM(BubbleSortAlgorithm, KeyedRecord);
+
 std::string BubbleSort::getDescription() const {
     return "Bubble Sort repeatedly compares adjacent elements and swaps them "
            "if they are in the wrong order. Larger elements 'bubble up' to the "
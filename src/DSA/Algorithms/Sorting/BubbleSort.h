@@ -3,20 +3,48 @@
 #pragma once
 
 #include "SorterBase.h"
+#include "SortAlgorithm.h"
+#include <utility>
 
 namespace DSA {
 
 
-class BubbleSort : public SorterBase {
+template <typename T>
+class BubbleSortAlgorithm : public SortAlgorithm {
 public:
     
-    BubbleSort() = default;
+    explicit BubbleSortAlgorithm(BasicArray<T> array);
     
     
-    virtual ~BubbleSort() = default;
+    const BasicArray<T>& getArray() const noexcept { return m_array; }
+    
+    
+    BasicArray<T> takeArray() noexcept { return std::move(m_array); }
+    
+    
+    template <typename Recorder>
+    void produce(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void run(Recorder& recorder);
+
+private:
+    BasicArray<T> m_array;
+    std::size_t m_size;
+    std::size_t m_pass;
+    std::size_t m_index;
+    bool m_swapped;
+};
+
+
+class BubbleSort : public AlgorithmSorter<BubbleSortAlgorithm> {
+public:
+    
+    BubbleSort() = default;
     
     
-    std::vector<SortStep> sort(const Array& array) override;
+    virtual ~BubbleSort() = default;
     
     
     std::string getName() const override { return "Bubble Sort"; }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace DSA {
+
+class IndexList {
+public:
+    static constexpr std::size_t INLINE_CAPACITY = 3;
+    
+    IndexList()
+        : m_indices()
+        , m_count(0)
+        , m_padding()
+    {}
+    
+    IndexList(std::initializer_list<std::size_t> indices)
+        : m_indices()
+        , m_count(0)
+        , m_padding()
+    {
+        for (std::size_t index : indices) {
+            pushBack(index);
+        }
+    }
+    
+    void pushBack(std::size_t index) {
+        if (m_count == INLINE_CAPACITY) {
+            throw std::length_error("IndexList inline capacity exceeded");
+        }
+        m_indices[m_count++] = index;
+    }
+    
+    std::size_t operator[](std::size_t position) const { return m_indices[position]; }
+    
+    bool empty() const noexcept { return m_count == 0; }
+    std::size_t size() const noexcept { return m_count; }
+    
+    const std::size_t* begin() const noexcept { return m_indices; }
+    const std::size_t* end() const noexcept { return m_indices + m_count; }
+    
+    void clear() noexcept { m_count = 0; }
+
+private:
+    std::size_t m_indices[INLINE_CAPACITY];
+    std::uint8_t m_count;
+    std::uint8_t m_padding[alignof(std::size_t) - 1];
+};
+
+}
@@ -1,88 +1,117 @@
 #include "InsertionSort.h"
 #include "../../Array/Array.h"
-#include <sstream>
-#include <map>
+#include <utility>
 
 namespace DSA {
 
-std::vector<SortStep> InsertionSort::sort(const Array& array) {
-    std::vector<SortStep> steps;
-
-    if (array.size() <= 1) {
-        if (array.size() == 1) {
-            steps.push_back(createCompleteStep(array));
-        }
-        return steps;
-    }
+template <typename T>
+InsertionSortAlgorithm<T>::InsertionSortAlgorithm(BasicArray<T> array)
+    : SortAlgorithm()
+    , m_array(std::move(array))
+    , m_size(m_array.size())
+    , m_index(1)
+    , m_position(1)
+    , m_key()
+    , m_phase(Phase::SelectKey)
+{
+}
 
-    Array workingArray = array;
+template <typename T>
+template <typename Recorder>
+void InsertionSortAlgorithm<T>::produce(Recorder& recorder) {
+    const BasicArray<T>& values = m_array;
     
-    std::size_t n = workingArray.size();
-
-    for (std::size_t i = 1; i < n; ++i) {
-        int key = workingArray[i];
-        std::size_t j = i;
-        
-        std::ostringstream highlightMsg;
-        highlightMsg << "Selecting element at index " << i 
-                     << " (value: " << key << ") to insert";
-        std::vector<std::size_t> highlightIndices = {i};
-        std::map<std::size_t, ElementRole> roles;
-        roles[i] = ElementRole::Key;
+    if (m_phase == Phase::SelectKey) {
+        if (m_index >= m_size) {
+            if (m_size > 0) {
+                recorder.record(SortEvent::None, [&]() { return createCompleteStep(); });
+            }
+            finish();
+            return;
+        }
         
-        SortStep keyStep = createHighlightStep(workingArray, highlightIndices, roles, highlightMsg.str());
-        keyStep.setAnnotation("key", std::to_string(key));
-        steps.push_back(keyStep);
+        m_key = values[m_index];
+        m_position = m_index;
         
-        while (j > 0 && workingArray[j - 1] > key) {
-            std::ostringstream compareMsg;
-            compareMsg << "Comparing element at index " << (j - 1) 
-                       << " (value: " << workingArray[j - 1] 
-                       << ") with key (value: " << key << ")";
-            std::vector<std::size_t> compareIndices = {j - 1, j};
+        recorder.record(SortEvent::None, [&]() {
+            IndexList highlightIndices = {m_index};
+            RoleSet roles;
+            roles.set(m_index, ElementRole::Key);
             
-            SortStep compareStep = createCompareStep(workingArray, compareIndices, compareMsg.str());
-            compareStep.setAnnotation("key", std::to_string(key));
-            steps.push_back(compareStep);
+            SortStep keyStep = createHighlightStep(highlightIndices, roles,
+                StepMessage(MessageID::SelectKey, m_index, displayValue(m_key)));
+            keyStep.setAnnotation(AnnotationKey::Key, displayValue(m_key));
+            return keyStep;
+        });
+        
+        m_phase = Phase::Shift;
+        return;
+    }
+    
+    std::size_t j = m_position;
+    if (j > 0) {
+        recorder.record(SortEvent::Compare, [&]() {
+            IndexList compareIndices = {j - 1, j};
             
-            workingArray[j] = workingArray[j - 1];
+            SortStep compareStep = createCompareStep(compareIndices,
+                StepMessage(MessageID::CompareWithKey, j - 1, displayValue(values[j - 1]), displayValue(m_key)));
+            compareStep.setAnnotation(AnnotationKey::Key, displayValue(m_key));
+            return compareStep;
+        });
+        
+        if (values[j - 1] > m_key) {
+            m_array[j] = values[j - 1];
             --j;
             
-            std::ostringstream shiftMsg;
-            shiftMsg << "Shifting element at index " << (j) 
-                     << " to index " << (j + 1);
-            std::vector<std::size_t> shiftIndices = {j, j + 1};
+            recorder.record(SortEvent::Write, [&]() {
+                IndexList shiftIndices = {j, j + 1};
+                
+                SortStep shiftStep = createWriteStep(shiftIndices, j + 1, stepValue(values[j + 1]),
+                    StepMessage(MessageID::ShiftElement, j, j + 1));
+                shiftStep.setAnnotation(AnnotationKey::Key, displayValue(m_key));
+                return shiftStep;
+            });
             
-            SortStep shiftStep = createHighlightStep(workingArray, shiftIndices, shiftMsg.str());
-            shiftStep.setAnnotation("key", std::to_string(key));
-            steps.push_back(shiftStep);
-        }
-        
-        if (j != i) {
-            workingArray[j] = key;
-            
-            std::ostringstream insertMsg;
-            insertMsg << "Inserting key at index " << j;
-            std::vector<std::size_t> insertIndices = {j};
-            steps.push_back(createHighlightStep(workingArray, insertIndices, insertMsg.str()));
+            m_position = j;
+            return;
         }
+    }
+    
+    if (j != m_index) {
+        m_array[j] = m_key;
         
-        std::ostringstream sortedMsg;
-        sortedMsg << "Elements up to index " << i << " are now sorted";
-        std::vector<std::size_t> sortedIndices;
-        std::map<std::size_t, ElementRole> sortedRoles;
-        for (std::size_t k = 0; k <= i; ++k) {
-            sortedIndices.push_back(k);
-            sortedRoles[k] = ElementRole::Sorted;
-        }
-        steps.push_back(createHighlightStep(workingArray, sortedIndices, sortedRoles, sortedMsg.str()));
+        recorder.record(SortEvent::Write, [&]() {
+            IndexList insertIndices = {j};
+            return createWriteStep(insertIndices, j, stepValue(m_key),
+                StepMessage(MessageID::InsertKey, j));
+        });
     }
-
-    steps.push_back(createCompleteStep(workingArray));
     
-    return steps;
+    recorder.record(SortEvent::Pass, [&]() {
+        RoleSet sortedRoles;
+        sortedRoles.setRange(0, m_index + 1, ElementRole::Sorted);
+        return createHighlightStep({}, sortedRoles,
+            StepMessage(MessageID::SortedPrefix, m_index));
+    });
+    
+    ++m_index;
+    m_phase = Phase::SelectKey;
 }
 
+template <typename T>
+template <typename Recorder>
+void InsertionSortAlgorithm<T>::run(Recorder& recorder) {
+    while (!isFinished()) {
+        produce(recorder);
+    }
+}
+
+DSA_INSTANTIATE_SORT_ALGORITHM(InsertionSortAlgorithm, int);
+DSA_INSTANTIATE_SORT_ALGORITHM(InsertionSortAlgorithm, std::int64_t);
+DSA_INSTANTIATE_SORT_ALGORITHM(InsertionSortAlgorithm, float);
+DSA_INSTANTIATE_SORT_ALGORITHM(InsertionSortAlgorithm, double);
+DSA_INSTANTIATE_SORT_ALGORITHM(InsertionSortAlgorithm, KeyedRecord);
+
 std::string InsertionSort::getDescription() const {
     return "Insertion Sort builds a sorted array one element at a time by "
            "inserting each element into its correct position in the sorted portion. "
@@ -3,20 +3,55 @@
 #pragma once
 
 #include "SorterBase.h"
+#include "SortAlgorithm.h"
+#include <utility>
 
 namespace DSA {
 
 
-class InsertionSort : public SorterBase {
+template <typename T>
+class InsertionSortAlgorithm : public SortAlgorithm {
 public:
     
-    InsertionSort() = default;
+    explicit InsertionSortAlgorithm(BasicArray<T> array);
     
     
-    virtual ~InsertionSort() = default;
+    const BasicArray<T>& getArray() const noexcept { return m_array; }
+    
+    
+    BasicArray<T> takeArray() noexcept { return std::move(m_array); }
+    
+    
+    template <typename Recorder>
+    void produce(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void run(Recorder& recorder);
+
+private:
     
+    enum class Phase {
+        SelectKey,
+        Shift
+    };
     
-    std::vector<SortStep> sort(const Array& array) override;
+    BasicArray<T> m_array;
+    std::size_t m_size;
+    std::size_t m_index;
+    std::size_t m_position;
+    T m_key;
+    Phase m_phase;
+};
+
+
+class InsertionSort : public AlgorithmSorter<InsertionSortAlgorithm> {
+public:
+    
+    InsertionSort() = default;
+    
+    
+    virtual ~InsertionSort() = default;
     
     
     std::string getName() const override { return "Insertion Sort"; }
@@ -0,0 +1,125 @@
+#include "MergeSort.h"
+#include "../../Array/Array.h"
+#include <utility>
+
+namespace DSA {
+
+template <typename T>
+MergeSortAlgorithm<T>::MergeSortAlgorithm(BasicArray<T> array)
+    : SortAlgorithm()
+    , m_array(std::move(array))
+    , m_auxiliary(m_array.size(), T(), m_array.resource())
+    , m_size(m_array.size())
+    , m_range{0, 0, 0}
+    , m_copyIndex(0)
+    , m_left(0)
+    , m_right(0)
+    , m_output(0)
+    , m_phase(Phase::Idle)
+{
+}
+
+template <typename T>
+void MergeSortAlgorithm<T>::beginMerge(const MergeRange& range) noexcept {
+    m_range = range;
+    m_copyIndex = range.begin;
+    m_phase = Phase::Copy;
+}
+
+template <typename T>
+template <typename Recorder>
+void MergeSortAlgorithm<T>::produceMerge(Recorder& recorder) {
+    const BasicArray<T>& values = m_array;
+    const BasicArray<T>& buffered = m_auxiliary;
+    
+    if (m_phase == Phase::Copy) {
+        std::size_t k = m_copyIndex;
+        m_auxiliary[k] = values[k];
+        
+        recorder.record(SortEvent::Write, [&]() {
+            return createAuxiliaryWriteStep(k, stepValue(buffered[k]),
+                StepMessage(MessageID::CopyToAuxiliary, k, displayValue(buffered[k])));
+        });
+        
+        if (++m_copyIndex == m_range.end) {
+            m_left = m_range.begin;
+            m_right = m_range.middle;
+            m_output = m_range.begin;
+            m_phase = Phase::Merge;
+        }
+        return;
+    }
+    
+    if (m_left < m_range.middle) {
+        std::size_t source = m_left;
+        if (m_right < m_range.end) {
+            std::size_t i = m_left;
+            std::size_t j = m_right;
+            
+            recorder.record(SortEvent::Compare, [&]() {
+                IndexList compareIndices = {i, j};
+                return createAuxiliaryCompareStep(compareIndices,
+                    StepMessage(MessageID::CompareMerge, i, j, displayValue(buffered[i]), displayValue(buffered[j])));
+            });
+            
+            if (buffered[i] > buffered[j]) {
+                source = j;
+            }
+        }
+        
+        std::size_t k = m_output;
+        m_array[k] = buffered[source];
+        
+        recorder.record(SortEvent::Write, [&]() {
+            IndexList writeIndices = {k};
+            return createWriteStep(writeIndices, k, stepValue(buffered[source]),
+                StepMessage(MessageID::MergeTake, source, displayValue(buffered[source]), k));
+        });
+        
+        if (source == m_left) {
+            ++m_left;
+        } else {
+            ++m_right;
+        }
+        ++m_output;
+        
+        if (m_left < m_range.middle) {
+            return;
+        }
+    }
+    
+    recorder.record(SortEvent::Pass, [&]() {
+        RoleSet mergedRoles;
+        mergedRoles.setRange(m_range.begin, m_range.end, ElementRole::Sorted);
+        return createHighlightStep({}, mergedRoles,
+            StepMessage(MessageID::MergeComplete, m_range.begin, m_range.end - 1));
+    });
+    
+    m_phase = Phase::Idle;
+}
+
+template <typename T>
+template <typename Recorder>
+void MergeSortAlgorithm<T>::produceCompletion(Recorder& recorder) {
+    if (m_size > 0) {
+        recorder.record(SortEvent::None, [&]() { return createCompleteStep(); });
+    }
+    finish();
+}
+
+#define DSA_INSTANTIATE_MERGE_SORT_ALGORITHM(Element) \
+    template class MergeSortAlgorithm<Element>; \
+    template void MergeSortAlgorithm<Element>::produceMerge(TraceRecorder& recorder); \
+    template void MergeSortAlgorithm<Element>::produceMerge(CountingRecorder& recorder); \
+    template void MergeSortAlgorithm<Element>::produceMerge(NullRecorder& recorder); \
+    template void MergeSortAlgorithm<Element>::produceCompletion(TraceRecorder& recorder); \
+    template void MergeSortAlgorithm<Element>::produceCompletion(CountingRecorder& recorder); \
+    template void MergeSortAlgorithm<Element>::produceCompletion(NullRecorder& recorder)
+
+DSA_INSTANTIATE_MERGE_SORT_ALGORITHM(int);
+DSA_INSTANTIATE_MERGE_SORT_ALGORITHM(std::int64_t);
+DSA_INSTANTIATE_MERGE_SORT_ALGORITHM(float);
+DSA_INSTANTIATE_MERGE_SORT_ALGORITHM(double);
+DSA_INSTANTIATE_MERGE_SORT_ALGORITHM(KeyedRecord);
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "SorterBase.h"
+#include "SortAlgorithm.h"
+#include "ParallelMergeSort.h"
+#include <utility>
+
+namespace DSA {
+
+
+template <typename T>
+class MergeSortAlgorithm : public SortAlgorithm {
+public:
+    
+    const BasicArray<T>& getArray() const noexcept { return m_array; }
+    
+    
+    const BasicArray<T>& getAuxiliary() const noexcept { return m_auxiliary; }
+    
+    
+    BasicArray<T> takeArray() noexcept { return std::move(m_array); }
+
+protected:
+    
+    struct MergeRange {
+        std::size_t begin;
+        std::size_t middle;
+        std::size_t end;
+    };
+    
+    
+    explicit MergeSortAlgorithm(BasicArray<T> array);
+    
+    
+    bool isMerging() const noexcept { return m_phase != Phase::Idle; }
+    
+    
+    void beginMerge(const MergeRange& range) noexcept;
+    
+    
+    template <typename Recorder>
+    void produceMerge(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void produceCompletion(Recorder& recorder);
+    
+    BasicArray<T> m_array;
+    BasicArray<T> m_auxiliary;
+    std::size_t m_size;
+
+private:
+    
+    enum class Phase {
+        Idle,
+        Copy,
+        Merge
+    };
+    
+    MergeRange m_range;
+    std::size_t m_copyIndex;
+    std::size_t m_left;
+    std::size_t m_right;
+    std::size_t m_output;
+    Phase m_phase;
+};
+
+
+template <template <typename> class Algorithm>
+class MergeSorter : public AlgorithmSorter<Algorithm> {
+public:
+    
+    void sortInPlace(Array& array) const override { parallelMergeSort(array); }
+    void sortInPlace(Int64Array& array) const override { parallelMergeSort(array); }
+    void sortInPlace(FloatArray& array) const override { parallelMergeSort(array); }
+    void sortInPlace(DoubleArray& array) const override { parallelMergeSort(array); }
+    void sortInPlace(RecordArray& array) const override { parallelMergeSort(array); }
+    
+    
+    std::size_t getAuxiliarySize(std::size_t elementCount) const override { return elementCount; }
+    
+    
+    std::string getTimeComplexity() const override { return "O(n log n)"; }
+    
+    
+    std::string getSpaceComplexity() const override { return "O(n)"; }
+};
+
+}
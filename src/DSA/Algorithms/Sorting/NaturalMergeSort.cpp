@@ -0,0 +1,114 @@
+#include "NaturalMergeSort.h"
+#include "../../Array/Array.h"
+#include <utility>
+
+namespace DSA {
+
+template <typename T>
+NaturalMergeSortAlgorithm<T>::NaturalMergeSortAlgorithm(BasicArray<T> array)
+    : MergeSortAlgorithm<T>(std::move(array))
+    , m_runs()
+    , m_mergedRuns()
+    , m_scanIndex(1)
+    , m_nextRun(0)
+    , m_pass(0)
+{
+    m_runs.push_back(0);
+    if (this->m_size <= 1) {
+        m_scanIndex = this->m_size;
+        m_runs.push_back(this->m_size);
+    }
+}
+
+template <typename T>
+template <typename Recorder>
+void NaturalMergeSortAlgorithm<T>::produceScan(Recorder& recorder) {
+    const BasicArray<T>& values = this->m_array;
+    std::size_t i = m_scanIndex;
+    
+    recorder.record(SortEvent::Compare, [&]() {
+        IndexList compareIndices = {i - 1, i};
+        return SortAlgorithm::createCompareStep(compareIndices,
+            StepMessage(MessageID::CompareAdjacent, i - 1, i,
+                        SortAlgorithm::displayValue(values[i - 1]), SortAlgorithm::displayValue(values[i])));
+    });
+    
+    if (values[i - 1] > values[i]) {
+        m_runs.push_back(i);
+        
+        recorder.record(SortEvent::None, [&]() {
+            IndexList boundaryIndices = {i - 1, i};
+            return SortAlgorithm::createHighlightStep(boundaryIndices,
+                StepMessage(MessageID::RunBoundary, i - 1,
+                            SortAlgorithm::displayValue(values[i - 1]), SortAlgorithm::displayValue(values[i])));
+        });
+    }
+    
+    if (++m_scanIndex == this->m_size) {
+        m_runs.push_back(this->m_size);
+    }
+}
+
+template <typename T>
+template <typename Recorder>
+void NaturalMergeSortAlgorithm<T>::produce(Recorder& recorder) {
+    if (this->isMerging()) {
+        this->produceMerge(recorder);
+        return;
+    }
+    
+    if (m_scanIndex < this->m_size) {
+        produceScan(recorder);
+        return;
+    }
+    
+    if (m_runs.size() <= 2) {
+        this->produceCompletion(recorder);
+        return;
+    }
+    
+    if (m_nextRun + 2 < m_runs.size()) {
+        std::size_t run = m_nextRun;
+        m_mergedRuns.push_back(m_runs[run]);
+        m_nextRun += 2;
+        this->beginMerge(MergeRange{m_runs[run], m_runs[run + 1], m_runs[run + 2]});
+        this->produceMerge(recorder);
+        return;
+    }
+    
+    if (m_nextRun + 1 < m_runs.size()) {
+        m_mergedRuns.push_back(m_runs[m_nextRun]);
+    }
+    m_mergedRuns.push_back(this->m_size);
+    m_runs.swap(m_mergedRuns);
+    m_mergedRuns.clear();
+    m_nextRun = 0;
+    ++m_pass;
+    
+    recorder.record(SortEvent::None, [&]() {
+        return SortAlgorithm::createHighlightStep({},
+            StepMessage(MessageID::RunsRemaining, m_pass, m_runs.size() - 1));
+    });
+}
+
+template <typename T>
+template <typename Recorder>
+void NaturalMergeSortAlgorithm<T>::run(Recorder& recorder) {
+    while (!this->isFinished()) {
+        produce(recorder);
+    }
+}
+
+DSA_INSTANTIATE_SORT_ALGORITHM(NaturalMergeSortAlgorithm, int);
+DSA_INSTANTIATE_SORT_ALGORITHM(NaturalMergeSortAlgorithm, std::int64_t);
+DSA_INSTANTIATE_SORT_ALGORITHM(NaturalMergeSortAlgorithm, float);
+DSA_INSTANTIATE_SORT_ALGORITHM(NaturalMergeSortAlgorithm, double);
+DSA_INSTANTIATE_SORT_ALGORITHM(NaturalMergeSortAlgorithm, KeyedRecord);
+
+std::string NaturalMergeSort::getDescription() const {
+    return "Natural Merge Sort first scans the array for ascending runs that already "
+           "exist, then merges neighbouring runs pass after pass. Nearly sorted input "
+           "finishes in very few passes, but every merge still uses an O(n) buffer.";
+}
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "MergeSort.h"
+#include <vector>
+
+namespace DSA {
+
+
+template <typename T>
+class NaturalMergeSortAlgorithm : public MergeSortAlgorithm<T> {
+public:
+    
+    explicit NaturalMergeSortAlgorithm(BasicArray<T> array);
+    
+    
+    template <typename Recorder>
+    void produce(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void run(Recorder& recorder);
+
+private:
+    
+    using MergeRange = typename MergeSortAlgorithm<T>::MergeRange;
+    
+    
+    template <typename Recorder>
+    void produceScan(Recorder& recorder);
+    
+    std::vector<std::size_t> m_runs;
+    std::vector<std::size_t> m_mergedRuns;
+    std::size_t m_scanIndex;
+    std::size_t m_nextRun;
+    std::size_t m_pass;
+};
+
+
+class NaturalMergeSort : public MergeSorter<NaturalMergeSortAlgorithm> {
+public:
+    
+    NaturalMergeSort() = default;
+    
+    
+    virtual ~NaturalMergeSort() = default;
+    
+    
+    std::string getName() const override { return "Natural Merge Sort"; }
+    
+    
+    std::string getDescription() const override;
+};
+
+}
@@ -0,0 +1,123 @@
+#include "ParallelMergeSort.h"
+#include "../../Array/ArrayKernels.h"
+#include "../../Array/ParallelFor.h"
+#include "../../../App/Config.h"
+#include <thread>
+
+namespace DSA {
+
+template <typename T>
+static void insertionSortRange(T* data, std::size_t count) {
+    for (std::size_t i = 1; i < count; ++i) {
+        T key = data[i];
+        std::size_t j = i;
+        while (j > 0 && data[j - 1] > key) {
+            data[j] = data[j - 1];
+            --j;
+        }
+        data[j] = key;
+    }
+}
+
+template <typename T>
+static void mergeRuns(const T* left, std::size_t leftCount,
+                      const T* right, std::size_t rightCount, T* out) {
+    std::size_t i = 0;
+    std::size_t j = 0;
+    std::size_t k = 0;
+    while (i < leftCount && j < rightCount) {
+        if (left[i] > right[j]) {
+            out[k++] = right[j++];
+        } else {
+            out[k++] = left[i++];
+        }
+    }
+    while (i < leftCount) {
+        out[k++] = left[i++];
+    }
+    while (j < rightCount) {
+        out[k++] = right[j++];
+    }
+}
+
+template <typename T>
+static std::size_t coRank(std::size_t rank, const T* left, std::size_t leftCount,
+                          const T* right, std::size_t rightCount) {
+    std::size_t low = rank > rightCount ? rank - rightCount : 0;
+    std::size_t high = rank < leftCount ? rank : leftCount;
+    while (low < high) {
+        std::size_t i = low + (high - low) / 2;
+        std::size_t j = rank - i;
+        if (j > 0 && !(left[i] > right[j - 1])) {
+            low = i + 1;
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+template <typename T>
+static void parallelMerge(const T* left, std::size_t leftCount,
+                          const T* right, std::size_t rightCount,
+                          T* out, std::size_t workers) {
+    std::size_t total = leftCount + rightCount;
+    parallelChunks(workers, [=](std::size_t worker) {
+        std::size_t begin = total * worker / workers;
+        std::size_t end = total * (worker + 1) / workers;
+        std::size_t leftBegin = coRank(begin, left, leftCount, right, rightCount);
+        std::size_t leftEnd = coRank(end, left, leftCount, right, rightCount);
+        std::size_t rightBegin = begin - leftBegin;
+        std::size_t rightEnd = end - leftEnd;
+        mergeRuns(left + leftBegin, leftEnd - leftBegin,
+                  right + rightBegin, rightEnd - rightBegin, out + begin);
+    });
+}
+
+template <typename T>
+static void sortRange(T* data, T* scratch, std::size_t count, std::size_t workers) {
+    if (count <= Config::MERGE_INSERTION_CUTOFF) {
+        insertionSortRange(data, count);
+        return;
+    }
+    if (count < Config::MERGE_PARALLEL_GRAIN) {
+        workers = 1;
+    }
+    
+    std::size_t half = count / 2;
+    if (workers > 1) {
+        std::size_t leftWorkers = workers / 2;
+        std::thread left([=]() { sortRange(data, scratch, half, leftWorkers); });
+        sortRange(data + half, scratch + half, count - half, workers - leftWorkers);
+        left.join();
+    } else {
+        sortRange(data, scratch, half, 1);
+        sortRange(data + half, scratch + half, count - half, 1);
+    }
+    
+    if (!(data[half - 1] > data[half])) {
+        return;
+    }
+    
+    ArrayKernels::copy(scratch, data, count);
+    parallelMerge(scratch, half, scratch + half, count - half, data, workers);
+}
+
+template <typename T>
+void parallelMergeSort(BasicArray<T>& array) {
+    std::size_t count = array.size();
+    if (count < 2) {
+        return;
+    }
+    
+    BasicArray<T> scratch(count, T(), array.resource());
+    sortRange(array.data(), scratch.data(), count, parallelWorkers(count, Config::MERGE_PARALLEL_GRAIN));
+}
+
+template void parallelMergeSort(BasicArray<int>& array);
+template void parallelMergeSort(BasicArray<std::int64_t>& array);
+template void parallelMergeSort(BasicArray<float>& array);
+template void parallelMergeSort(BasicArray<double>& array);
+template void parallelMergeSort(BasicArray<KeyedRecord>& array);
+
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../../Array/Array.h"
+
+namespace DSA {
+
+template <typename T>
+void parallelMergeSort(BasicArray<T>& array);
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "SortStep.h"
+#include "SortStats.h"
+#include <vector>
+
+namespace DSA {
+
+class TraceRecorder {
+public:
+    template <typename Builder>
+    void record(SortEvent event, Builder&& build) {
+        m_stats.count(event);
+        m_steps.push_back(build());
+    }
+    
+    std::vector<SortStep>& getSteps() noexcept { return m_steps; }
+    const std::vector<SortStep>& getSteps() const noexcept { return m_steps; }
+    const SortStats& getStats() const noexcept { return m_stats; }
+
+private:
+    std::vector<SortStep> m_steps;
+    SortStats m_stats;
+};
+
+class CountingRecorder {
+public:
+    template <typename Builder>
+    void record(SortEvent event, Builder&&) {
+        m_stats.count(event);
+    }
+    
+    const SortStats& getStats() const noexcept { return m_stats; }
+
+private:
+    SortStats m_stats;
+};
+
+class NullRecorder {
+public:
+    template <typename Builder>
+    void record(SortEvent, Builder&&) {}
+};
+
+}
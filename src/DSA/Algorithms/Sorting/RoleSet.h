@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+namespace DSA {
+
+enum class ElementRole : std::uint8_t {
+    None = 0,
+    Key,
+    Minimum,
+    Maximum,
+    Pivot,
+    Sorted,
+    Active,
+    Compared,
+    Swapped
+};
+
+class RoleSet {
+public:
+    static constexpr std::size_t INLINE_CAPACITY = 4;
+    
+    struct Entry {
+        std::size_t index;
+        ElementRole role;
+        std::uint8_t padding[alignof(std::size_t) - 1] = {};
+    };
+    
+    RoleSet()
+        : m_entries()
+        , m_count(0)
+        , m_rangeRole(ElementRole::None)
+        , m_padding()
+        , m_rangeBegin(0)
+        , m_rangeEnd(0)
+    {}
+    
+    void set(std::size_t index, ElementRole role) {
+        for (std::uint8_t i = 0; i < m_count; ++i) {
+            if (m_entries[i].index == index) {
+                m_entries[i].role = role;
+                return;
+            }
+        }
+        
+        if (m_count == INLINE_CAPACITY) {
+            throw std::length_error("RoleSet inline capacity exceeded");
+        }
+        m_entries[m_count++] = Entry{index, role};
+    }
+    
+    void setRange(std::size_t begin, std::size_t end, ElementRole role) {
+        m_rangeBegin = begin;
+        m_rangeEnd = end;
+        m_rangeRole = role;
+    }
+    
+    ElementRole get(std::size_t index) const {
+        for (std::uint8_t i = 0; i < m_count; ++i) {
+            if (m_entries[i].index == index) {
+                return m_entries[i].role;
+            }
+        }
+        
+        if (index >= m_rangeBegin && index < m_rangeEnd) {
+            return m_rangeRole;
+        }
+        return ElementRole::None;
+    }
+    
+    bool hasRange() const noexcept { return m_rangeEnd > m_rangeBegin; }
+    ElementRole getRangeRole() const noexcept { return m_rangeRole; }
+    std::size_t getRangeBegin() const noexcept { return m_rangeBegin; }
+    std::size_t getRangeEnd() const noexcept { return m_rangeEnd; }
+    
+    bool empty() const noexcept { return m_count == 0 && !hasRange(); }
+    std::size_t size() const noexcept { return m_count; }
+    
+    const Entry* begin() const noexcept { return m_entries; }
+    const Entry* end() const noexcept { return m_entries + m_count; }
+    
+    void clear() noexcept {
+        m_count = 0;
+        m_rangeRole = ElementRole::None;
+        m_rangeBegin = 0;
+        m_rangeEnd = 0;
+    }
+
+private:
+    Entry m_entries[INLINE_CAPACITY];
+    std::uint8_t m_count;
+    ElementRole m_rangeRole;
+    std::uint8_t m_padding[alignof(std::size_t) - 2];
+    std::size_t m_rangeBegin;
+    std::size_t m_rangeEnd;
+};
+
+}
@@ -1,108 +1,135 @@
 #include "SelectionSort.h"
 #include "../../Array/Array.h"
-#include <sstream>
-#include <map>
+#include <utility>
 
 namespace DSA {
 
-std::vector<SortStep> SelectionSort::sort(const Array& array) {
-    std::vector<SortStep> steps;
+template <typename T>
+SelectionSortAlgorithm<T>::SelectionSortAlgorithm(BasicArray<T> array)
+    : SortAlgorithm()
+    , m_array(std::move(array))
+    , m_size(m_array.size())
+    , m_index(0)
+    , m_scanIndex(0)
+    , m_minIndex(0)
+    , m_phase(Phase::StartPass)
+{
+}
 
-    if (array.size() <= 1) {
-        if (array.size() == 1) {
-            steps.push_back(createCompleteStep(array));
+template <typename T>
+template <typename Recorder>
+void SelectionSortAlgorithm<T>::produce(Recorder& recorder) {
+    const BasicArray<T>& values = m_array;
+    
+    if (m_phase == Phase::StartPass) {
+        if (m_size <= 1 || m_index >= m_size - 1) {
+            if (m_size > 0) {
+                recorder.record(SortEvent::None, [&]() { return createCompleteStep(); });
+            }
+            finish();
+            return;
         }
-        return steps;
+        
+        m_minIndex = m_index;
+        m_scanIndex = m_index + 1;
+        
+        recorder.record(SortEvent::None, [&]() {
+            IndexList startIndices = {m_index};
+            RoleSet startRoles;
+            startRoles.set(m_index, ElementRole::Minimum);
+            SortStep startStep = createHighlightStep(startIndices, startRoles,
+                StepMessage(MessageID::StartMinimumSearch, m_index + 1, m_index));
+            startStep.setAnnotation(AnnotationKey::Minimum, displayValue(values[m_minIndex]));
+            return startStep;
+        });
+        
+        m_phase = Phase::Scan;
+        return;
     }
-
-    Array workingArray = array;
     
-    std::size_t n = workingArray.size();
-
-    for (std::size_t i = 0; i < n - 1; ++i) {
-        std::size_t minIndex = i;
+    if (m_phase == Phase::Scan) {
+        if (m_scanIndex >= m_size) {
+            m_phase = Phase::FinishPass;
+            return;
+        }
         
-        std::ostringstream startMsg;
-        startMsg << "Starting pass " << (i + 1) << ", searching for minimum from index " << i;
-        std::vector<std::size_t> startIndices = {i};
-        std::map<std::size_t, ElementRole> startRoles;
-        startRoles[i] = ElementRole::Minimum;
-        SortStep startStep = createHighlightStep(workingArray, startIndices, startRoles, startMsg.str());
-        startStep.setAnnotation("minimum", std::to_string(workingArray[minIndex]));
-        steps.push_back(startStep);
+        std::size_t j = m_scanIndex;
+        recorder.record(SortEvent::Compare, [&]() {
+            IndexList compareIndices = {j, m_minIndex};
+            SortStep compareStep = createCompareStep(compareIndices,
+                StepMessage(MessageID::CompareWithMinimum, j, displayValue(values[j]), m_minIndex, displayValue(values[m_minIndex])));
+            compareStep.setRole(m_minIndex, ElementRole::Minimum);
+            compareStep.setAnnotation(AnnotationKey::Minimum, displayValue(values[m_minIndex]));
+            return compareStep;
+        });
         
-        for (std::size_t j = i + 1; j < n; ++j) {
-            std::ostringstream compareMsg;
-            compareMsg << "Comparing element at index " << j 
-                       << " (value: " << workingArray[j] 
-                       << ") with minimum at index " << minIndex 
-                       << " (value: " << workingArray[minIndex] << ")";
-            std::vector<std::size_t> compareIndices = {j, minIndex};
-            SortStep compareStep = createCompareStep(workingArray, compareIndices, compareMsg.str());
-            std::map<std::size_t, ElementRole> compareRoles;
-            compareRoles[minIndex] = ElementRole::Minimum;
-            compareStep.roles = compareRoles;
-            compareStep.setAnnotation("minimum", std::to_string(workingArray[minIndex]));
-            steps.push_back(compareStep);
+        if (values[j] < values[m_minIndex]) {
+            m_minIndex = j;
             
-            if (workingArray[j] < workingArray[minIndex]) {
-                minIndex = j;
+            recorder.record(SortEvent::None, [&]() {
+                IndexList minIndices = {m_minIndex};
+                RoleSet roles;
+                roles.set(m_minIndex, ElementRole::Minimum);
                 
-                std::ostringstream newMinMsg;
-                newMinMsg << "New minimum found at index " << minIndex 
-                          << " (value: " << workingArray[minIndex] << ")";
-                std::vector<std::size_t> minIndices = {minIndex};
-                std::map<std::size_t, ElementRole> roles;
-                roles[minIndex] = ElementRole::Minimum;
-                
-                SortStep minStep = createHighlightStep(workingArray, minIndices, roles, newMinMsg.str());
-                minStep.setAnnotation("minimum", std::to_string(workingArray[minIndex]));
-                steps.push_back(minStep);
-            }
+                SortStep minStep = createHighlightStep(minIndices, roles,
+                    StepMessage(MessageID::NewMinimum, m_minIndex, displayValue(values[m_minIndex])));
+                minStep.setAnnotation(AnnotationKey::Minimum, displayValue(values[m_minIndex]));
+                return minStep;
+            });
         }
         
-        if (minIndex != i) {
-            std::ostringstream swapMsg;
-            swapMsg << "Swapping minimum at index " << minIndex 
-                    << " (value: " << workingArray[minIndex] 
-                    << ") with element at index " << i 
-                    << " (value: " << workingArray[i] << ")";
-            SortStep swapStep = createSwapStep(workingArray, i, minIndex, swapMsg.str());
-            std::map<std::size_t, ElementRole> swapRoles;
-            swapRoles[minIndex] = ElementRole::Minimum;
-            swapStep.roles = swapRoles;
-            swapStep.setAnnotation("minimum", std::to_string(workingArray[minIndex]));
-            steps.push_back(swapStep);
-            
-            workingArray.swap(i, minIndex);
-        } else {
-            std::ostringstream noSwapMsg;
-            noSwapMsg << "Element at index " << i 
-                      << " is already in correct position";
-            std::vector<std::size_t> noSwapIndices = {i};
-            std::map<std::size_t, ElementRole> noSwapRoles;
-            noSwapRoles[i] = ElementRole::Minimum;
-            SortStep noSwapStep = createHighlightStep(workingArray, noSwapIndices, noSwapRoles, noSwapMsg.str());
-            noSwapStep.setAnnotation("minimum", std::to_string(workingArray[i]));
-            steps.push_back(noSwapStep);
-        }
+        ++m_scanIndex;
+        return;
+    }
+    
+    std::size_t i = m_index;
+    if (m_minIndex != i) {
+        recorder.record(SortEvent::Swap, [&]() {
+            SortStep swapStep = createSwapStep(i, m_minIndex,
+                StepMessage(MessageID::SwapMinimum, m_minIndex, displayValue(values[m_minIndex]), i, displayValue(values[i])));
+            swapStep.setRole(m_minIndex, ElementRole::Minimum);
+            swapStep.setAnnotation(AnnotationKey::Minimum, displayValue(values[m_minIndex]));
+            return swapStep;
+        });
         
-        std::ostringstream sortedMsg;
-        sortedMsg << "Elements up to index " << i << " are now sorted";
-        std::vector<std::size_t> sortedIndices;
-        std::map<std::size_t, ElementRole> sortedRoles;
-        for (std::size_t k = 0; k <= i; ++k) {
-            sortedIndices.push_back(k);
-            sortedRoles[k] = ElementRole::Sorted;
-        }
-        steps.push_back(createHighlightStep(workingArray, sortedIndices, sortedRoles, sortedMsg.str()));
+        m_array.swap(i, m_minIndex);
+    } else {
+        recorder.record(SortEvent::None, [&]() {
+            IndexList noSwapIndices = {i};
+            RoleSet noSwapRoles;
+            noSwapRoles.set(i, ElementRole::Minimum);
+            SortStep noSwapStep = createHighlightStep(noSwapIndices, noSwapRoles,
+                StepMessage(MessageID::AlreadyInPlace, i));
+            noSwapStep.setAnnotation(AnnotationKey::Minimum, displayValue(values[i]));
+            return noSwapStep;
+        });
     }
-
-    steps.push_back(createCompleteStep(workingArray));
     
-    return steps;
+    recorder.record(SortEvent::Pass, [&]() {
+        RoleSet sortedRoles;
+        sortedRoles.setRange(0, i + 1, ElementRole::Sorted);
+        return createHighlightStep({}, sortedRoles,
+            StepMessage(MessageID::SortedPrefix, i));
+    });
+    
+    ++m_index;
+    m_phase = Phase::StartPass;
 }
 
+template <typename T>
+template <typename Recorder>
+void SelectionSortAlgorithm<T>::run(Recorder& recorder) {
+    while (!isFinished()) {
+        produce(recorder);
+    }
+}
+
+DSA_INSTANTIATE_SORT_ALGORITHM(SelectionSortAlgorithm, int);
+DSA_INSTANTIATE_SORT_ALGORITHM(SelectionSortAlgorithm, std::int64_t);
+DSA_INSTANTIATE_SORT_ALGORITHM(SelectionSortAlgorithm, float);
+DSA_INSTANTIATE_SORT_ALGORITHM(SelectionSortAlgorithm, double);
+DSA_INSTANTIATE_SORT_ALGORITHM(SelectionSortAlgorithm, KeyedRecord);
+
 std::string SelectionSort::getDescription() const {
     return "Selection Sort repeatedly finds the minimum element from the "
            "unsorted portion and places it at the beginning. "
@@ -3,20 +3,56 @@
 #pragma once
 
 #include "SorterBase.h"
+#include "SortAlgorithm.h"
+#include <utility>
 
 namespace DSA {
 
 
-class SelectionSort : public SorterBase {
+template <typename T>
+class SelectionSortAlgorithm : public SortAlgorithm {
 public:
     
-    SelectionSort() = default;
+    explicit SelectionSortAlgorithm(BasicArray<T> array);
     
     
-    virtual ~SelectionSort() = default;
+    const BasicArray<T>& getArray() const noexcept { return m_array; }
+    
+    
+    BasicArray<T> takeArray() noexcept { return std::move(m_array); }
+    
+    
+    template <typename Recorder>
+    void produce(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void run(Recorder& recorder);
+
+private:
     
+    enum class Phase {
+        StartPass,
+        Scan,
+        FinishPass
+    };
     
-    std::vector<SortStep> sort(const Array& array) override;
+    BasicArray<T> m_array;
+    std::size_t m_size;
+    std::size_t m_index;
+    std::size_t m_scanIndex;
+    std::size_t m_minIndex;
+    Phase m_phase;
+};
+
+
+class SelectionSort : public AlgorithmSorter<SelectionSortAlgorithm> {
+public:
+    
+    SelectionSort() = default;
+    
+    
+    virtual ~SelectionSort() = default;
     
     
     std::string getName() const override { return "Selection Sort"; }
@@ -0,0 +1,60 @@
+#include "SortAlgorithm.h"
+
+namespace DSA {
+
+SortAlgorithm::SortAlgorithm()
+    : m_finished(false)
+    , m_projection()
+{
+}
+
+SortStep SortAlgorithm::createCompareStep(const IndexList& indices,
+                                          const StepMessage& message) {
+    return SortStep(StepType::Compare, indices, message);
+}
+
+SortStep SortAlgorithm::createSwapStep(std::size_t i,
+                                       std::size_t j,
+                                       const StepMessage& message) {
+    IndexList indices = {i, j};
+    return SortStep(StepType::Swap, indices, message, StepDelta::swap(i, j));
+}
+
+SortStep SortAlgorithm::createWriteStep(const IndexList& indices,
+                                        std::size_t index,
+                                        int value,
+                                        const StepMessage& message) {
+    return SortStep(StepType::Highlight, indices, message, StepDelta::write(index, value));
+}
+
+SortStep SortAlgorithm::createAuxiliaryWriteStep(std::size_t index,
+                                                 int value,
+                                                 const StepMessage& message) {
+    SortStep step(StepType::Highlight, {index}, message, StepDelta::writeAuxiliary(index, value));
+    step.buffer = StepBuffer::Auxiliary;
+    return step;
+}
+
+SortStep SortAlgorithm::createAuxiliaryCompareStep(const IndexList& indices,
+                                                   const StepMessage& message) {
+    SortStep step(StepType::Compare, indices, message);
+    step.buffer = StepBuffer::Auxiliary;
+    return step;
+}
+
+SortStep SortAlgorithm::createHighlightStep(const IndexList& indices,
+                                            const StepMessage& message) {
+    return SortStep(StepType::Highlight, indices, message);
+}
+
+SortStep SortAlgorithm::createHighlightStep(const IndexList& indices,
+                                            const RoleSet& roles,
+                                            const StepMessage& message) {
+    return SortStep(StepType::Highlight, indices, roles, message);
+}
+
+SortStep SortAlgorithm::createCompleteStep() {
+    return SortStep(StepType::Complete, {}, StepMessage(MessageID::Completed));
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "SortStep.h"
+#include "Recorder.h"
+#include "../../Array/Array.h"
+#include "../../Array/KeyProjection.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace DSA {
+
+class SortAlgorithm {
+public:
+    bool isFinished() const noexcept { return m_finished; }
+    
+    void setProjection(const KeyProjection& projection) noexcept { m_projection = projection; }
+
+protected:
+    SortAlgorithm();
+    
+    void finish() noexcept { m_finished = true; }
+    
+    template <typename T>
+    static std::int64_t displayValue(const T& value) { return ElementTraits<T>::display(value); }
+    
+    template <typename T>
+    int stepValue(const T& value) const { return m_projection(value); }
+    
+    static SortStep createCompareStep(const IndexList& indices,
+                                      const StepMessage& message);
+    
+    static SortStep createSwapStep(std::size_t i,
+                                   std::size_t j,
+                                   const StepMessage& message);
+    
+    static SortStep createWriteStep(const IndexList& indices,
+                                    std::size_t index,
+                                    int value,
+                                    const StepMessage& message);
+    
+    static SortStep createAuxiliaryWriteStep(std::size_t index,
+                                             int value,
+                                             const StepMessage& message);
+    
+    static SortStep createAuxiliaryCompareStep(const IndexList& indices,
+                                               const StepMessage& message);
+    
+    static SortStep createHighlightStep(const IndexList& indices,
+                                        const StepMessage& message);
+    
+    static SortStep createHighlightStep(const IndexList& indices,
+                                        const RoleSet& roles,
+                                        const StepMessage& message);
+    
+    static SortStep createCompleteStep();
+
+private:
+    bool m_finished;
+    KeyProjection m_projection;
+};
+
+#define DSA_INSTANTIATE_SORT_ALGORITHM(Algorithm, Element) \
+    template class Algorithm<Element>; \
+    template void Algorithm<Element>::produce(TraceRecorder& recorder); \
+    template void Algorithm<Element>::run(CountingRecorder& recorder); \
+    template void Algorithm<Element>::run(NullRecorder& recorder)
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DSA {
+
+enum class SortEvent : std::uint8_t {
+    None = 0,
+    Compare,
+    Swap,
+    Write,
+    Pass
+};
+
+struct SortStats {
+    std::uint64_t comparisons = 0;
+    std::uint64_t swaps = 0;
+    std::uint64_t writes = 0;
+    std::uint64_t passes = 0;
+    
+    void count(SortEvent event) {
+        switch (event) {
+            case SortEvent::Compare:
+                ++comparisons;
+                break;
+                
+            case SortEvent::Swap:
+                ++swaps;
+                break;
+                
+            case SortEvent::Write:
+                ++writes;
+                break;
+                
+            case SortEvent::Pass:
+                ++passes;
+                break;
+                
+            default:
+                break;
+        }
+    }
+};
+
+}
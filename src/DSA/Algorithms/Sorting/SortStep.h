@@ -1,10 +1,11 @@
 #pragma once
 
 #include <cstdint>
-#include <vector>
-#include <string>
-#include <map>
-#include "DSA/Array/Array.h"
+#include <cstddef>
+#include "Annotation.h"
+#include "IndexList.h"
+#include "RoleSet.h"
+#include "StepMessage.h"
 
 namespace DSA {
 
@@ -15,70 +16,106 @@ enum class StepType : std::uint8_t {
     Complete
 };
 
-enum class ElementRole : std::uint8_t {
+enum class DeltaType : std::uint8_t {
     None = 0,
-    Key,
-    Minimum,
-    Maximum,
-    Pivot,
-    Sorted,
-    Active,
-    Compared,
-    Swapped
+    Swap,
+    Write
+};
+
+enum class StepBuffer : std::uint8_t {
+    Main = 0,
+    Auxiliary
+};
+
+struct StepDelta {
+    DeltaType type = DeltaType::None;
+    StepBuffer buffer = StepBuffer::Main;
+    std::uint8_t padding[alignof(std::size_t) - 2] = {};
+    std::size_t first = 0;
+    std::size_t second = 0;
+    int value = 0;
+    int previous = 0;
+    
+    static StepDelta swap(std::size_t i, std::size_t j) {
+        StepDelta delta;
+        delta.type = DeltaType::Swap;
+        delta.first = i;
+        delta.second = j;
+        return delta;
+    }
+    
+    static StepDelta write(std::size_t index, int newValue) {
+        StepDelta delta;
+        delta.type = DeltaType::Write;
+        delta.first = index;
+        delta.value = newValue;
+        return delta;
+    }
+    
+    static StepDelta writeAuxiliary(std::size_t index, int newValue) {
+        StepDelta delta = write(index, newValue);
+        delta.buffer = StepBuffer::Auxiliary;
+        return delta;
+    }
 };
 
 struct SortStep {
-    StepType type;
-    std::vector<std::size_t> indices;
-    std::map<std::size_t, ElementRole> roles;
-    std::map<std::string, std::string> annotations;
-    std::string message;
-    Array arrayState;
+    StepType type = StepType::Compare;
+    StepBuffer buffer = StepBuffer::Main;
+    std::uint8_t padding[alignof(IndexList) - 2] = {};
+    IndexList indices;
+    RoleSet roles;
+    AnnotationSet annotations;
+    StepMessage message;
+    StepDelta delta;
     
     SortStep() = default;
     
     SortStep(StepType stepType, 
-             const std::vector<std::size_t>& stepIndices,
-             const std::string& stepMessage,
-             const Array& state)
+             const IndexList& stepIndices,
+             const StepMessage& stepMessage,
+             const StepDelta& stepDelta = StepDelta())
         : type(stepType)
         , indices(stepIndices)
         , message(stepMessage)
-        , arrayState(state)
+        , delta(stepDelta)
     {}
     
     SortStep(StepType stepType, 
-             const std::vector<std::size_t>& stepIndices,
-             const std::map<std::size_t, ElementRole>& stepRoles,
-             const std::string& stepMessage,
-             const Array& state)
+             const IndexList& stepIndices,
+             const RoleSet& stepRoles,
+             const StepMessage& stepMessage,
+             const StepDelta& stepDelta = StepDelta())
         : type(stepType)
         , indices(stepIndices)
         , roles(stepRoles)
         , message(stepMessage)
-        , arrayState(state)
+        , delta(stepDelta)
     {}
     
+    bool changesArray() const {
+        return delta.type != DeltaType::None;
+    }
+    
     void setRole(std::size_t index, ElementRole role) {
-        roles[index] = role;
+        roles.set(index, role);
     }
     
     ElementRole getRole(std::size_t index) const {
-        auto it = roles.find(index);
-        return (it != roles.end()) ? it->second : ElementRole::None;
+        return roles.get(index);
     }
     
-    void setAnnotation(const std::string& key, const std::string& value) {
-        annotations[key] = value;
+    void setAnnotation(AnnotationKey key, std::int64_t value) {
+        annotations.set(key, value);
     }
     
-    std::string getAnnotation(const std::string& key) const {
-        auto it = annotations.find(key);
-        return (it != annotations.end()) ? it->second : "";
+    std::int64_t getAnnotation(AnnotationKey key) const {
+        const AnnotationSet::Entry* entry = annotations.find(key);
+        return entry ? entry->value : 0;
     }
     
-    bool hasAnnotation(const std::string& key) const {
-        return annotations.find(key) != annotations.end();
+    bool hasAnnotation(AnnotationKey key) const {
+        return annotations.find(key) != nullptr;
     }
 };
 
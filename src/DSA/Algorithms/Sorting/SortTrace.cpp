@@ -0,0 +1,293 @@
+#include "SortTrace.h"
+#include "../../Array/ArrayKernels.h"
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace DSA {
+
+static_assert(std::is_trivially_destructible<SortStep>::value, "SortStep must be trivially destructible");
+static_assert(sizeof(SortStep) <= 256, "SortStep must stay a fixed record of at most 256 bytes");
+
+SortTrace::SortTrace()
+    : SortTrace(Array())
+{
+}
+
+SortTrace::SortTrace(const Array& initialState, std::size_t auxiliarySize)
+    : m_initialState(initialState)
+    , m_auxiliarySize(auxiliarySize)
+    , m_tipState(initialState)
+    , m_tipAuxiliary(auxiliarySize)
+    , m_arena()
+    , m_segments()
+    , m_segmentUses()
+    , m_residentSegments()
+    , m_freeSegments()
+    , m_useCounter(0)
+    , m_spillOffsets()
+    , m_spillFile()
+    , m_memoryBudget(Config::TRACE_MEMORY_BUDGET_BYTES)
+    , m_size(0)
+    , m_mapping()
+    , m_mappedSteps(nullptr)
+    , m_index()
+    , m_keyframes()
+    , m_freeKeyframes()
+    , m_keyframeInterval(Config::TRACE_MIN_KEYFRAME_INTERVAL)
+    , m_keyframeBudget(Config::TRACE_KEYFRAME_BUDGET_BYTES)
+{
+    addKeyframe(m_initialState, m_tipAuxiliary);
+}
+
+SortTrace::SortTrace(const Array& initialState, std::size_t auxiliarySize, std::unique_ptr<MappedFile> mapping,
+                     const SortStep* steps, std::size_t stepCount)
+    : SortTrace(initialState, auxiliarySize)
+{
+    m_mapping = std::move(mapping);
+    m_mappedSteps = steps;
+    m_size = stepCount;
+    for (std::size_t i = 0; i < m_size; ++i) {
+        m_index.add(i, m_mappedSteps[i]);
+    }
+    rebuildKeyframes();
+}
+
+void SortTrace::push(SortStep step) {
+    if (m_mappedSteps) {
+        throw std::logic_error("Cannot append steps to a mapped trace");
+    }
+    
+    if (step.delta.type == DeltaType::Write) {
+        const Array& target = step.delta.buffer == StepBuffer::Auxiliary ? m_tipAuxiliary : m_tipState;
+        step.delta.previous = target.at(step.delta.first);
+    }
+    applyDelta(m_tipState, m_tipAuxiliary, step.delta);
+    
+    std::size_t offset = m_size % Config::TRACE_STEP_SEGMENT_SIZE;
+    if (offset == 0) {
+        trimResident(1);
+        m_residentSegments.push_back(m_segments.size());
+        m_segments.push_back(acquireSegment());
+        m_segmentUses.push_back(++m_useCounter);
+        m_spillOffsets.push_back(NOT_SPILLED);
+    }
+    new (m_segments.back() + offset) SortStep(std::move(step));
+    m_index.add(m_size, m_segments.back()[offset]);
+    ++m_size;
+    
+    if (m_size % m_keyframeInterval == 0) {
+        addKeyframe(m_tipState, m_tipAuxiliary);
+        if (keyframeBytes(m_keyframes.size()) > m_keyframeBudget) {
+            thinKeyframes();
+        }
+    }
+}
+
+void SortTrace::clear() {
+    m_arena.release();
+    m_segments.clear();
+    m_segmentUses.clear();
+    m_residentSegments.clear();
+    m_freeSegments.clear();
+    m_useCounter = 0;
+    m_spillOffsets.clear();
+    m_spillFile.close();
+    m_size = 0;
+    m_mapping.reset();
+    m_mappedSteps = nullptr;
+    m_index.clear();
+    m_tipState = m_initialState;
+    m_tipAuxiliary.fill(0);
+    m_keyframes.clear();
+    m_freeKeyframes.clear();
+    m_keyframeInterval = Config::TRACE_MIN_KEYFRAME_INTERVAL;
+    addKeyframe(m_initialState, m_tipAuxiliary);
+}
+
+Array SortTrace::stateAt(std::size_t index) const {
+    Array state;
+    restoreState(index, state);
+    return state;
+}
+
+void SortTrace::restoreState(std::size_t index, Array& out) const {
+    Array auxiliary;
+    restoreState(index, out, auxiliary);
+}
+
+void SortTrace::restoreState(std::size_t index, Array& out, Array& auxiliary) const {
+    if (index >= m_size) {
+        throw std::out_of_range("Trace step index out of range");
+    }
+    
+    std::size_t target = index + 1;
+    std::size_t keyframe = target / m_keyframeInterval;
+    const int* values = m_keyframes[keyframe];
+    
+    out.assign(ArrayView(values, m_initialState.size()));
+    auxiliary.assign(ArrayView(values + m_initialState.size(), m_auxiliarySize));
+    for (std::size_t i = keyframe * m_keyframeInterval; i < target; ++i) {
+        applyDelta(out, auxiliary, deltaAt(i));
+    }
+}
+
+void SortTrace::setKeyframeBudget(std::size_t budgetBytes) {
+    if (budgetBytes == m_keyframeBudget) {
+        return;
+    }
+    
+    m_keyframeBudget = budgetBytes;
+    rebuildKeyframes();
+}
+
+void SortTrace::setMemoryBudget(std::size_t budgetBytes) {
+    m_memoryBudget = budgetBytes;
+    trimResident(0);
+}
+
+void SortTrace::applyDelta(Array& array, Array& auxiliary, const StepDelta& delta) {
+    Array& target = delta.buffer == StepBuffer::Auxiliary ? auxiliary : array;
+    switch (delta.type) {
+        case DeltaType::Swap:
+            target.swap(delta.first, delta.second);
+            break;
+            
+        case DeltaType::Write:
+            target.at(delta.first) = delta.value;
+            break;
+            
+        default:
+            break;
+    }
+}
+
+void SortTrace::revertDelta(Array& array, Array& auxiliary, const StepDelta& delta) {
+    Array& target = delta.buffer == StepBuffer::Auxiliary ? auxiliary : array;
+    switch (delta.type) {
+        case DeltaType::Swap:
+            target.swap(delta.first, delta.second);
+            break;
+            
+        case DeltaType::Write:
+            target.at(delta.first) = delta.previous;
+            break;
+            
+        default:
+            break;
+    }
+}
+
+std::size_t SortTrace::maxResidentSegments() const noexcept {
+    std::size_t segments = m_memoryBudget / segmentBytes();
+    return segments < Config::TRACE_MIN_RESIDENT_SEGMENTS ? Config::TRACE_MIN_RESIDENT_SEGMENTS : segments;
+}
+
+SortStep* SortTrace::acquireSegment() const {
+    if (!m_freeSegments.empty()) {
+        SortStep* steps = m_freeSegments.back();
+        m_freeSegments.pop_back();
+        return steps;
+    }
+    return m_arena.allocateArray<SortStep>(Config::TRACE_STEP_SEGMENT_SIZE);
+}
+
+SortStep* SortTrace::pageIn(std::size_t segment) const {
+    trimResident(1);
+    SortStep* steps = acquireSegment();
+    m_spillFile.read(m_spillOffsets[segment], steps, segmentBytes());
+    m_segments[segment] = steps;
+    m_residentSegments.push_back(segment);
+    return steps;
+}
+
+void SortTrace::trimResident(std::size_t reserve) const {
+    std::size_t tip = m_segments.size() - 1;
+    while (m_residentSegments.size() + reserve > maxResidentSegments()) {
+        std::size_t victim = m_residentSegments.size();
+        for (std::size_t slot = 0; slot < m_residentSegments.size(); ++slot) {
+            std::size_t segment = m_residentSegments[slot];
+            if (segment != tip && (victim == m_residentSegments.size() ||
+                                   m_segmentUses[segment] < m_segmentUses[m_residentSegments[victim]])) {
+                victim = slot;
+            }
+        }
+        if (victim == m_residentSegments.size()) {
+            return;
+        }
+        evictSegment(victim);
+    }
+}
+
+void SortTrace::evictSegment(std::size_t residentSlot) const {
+    std::size_t segment = m_residentSegments[residentSlot];
+    if (m_spillOffsets[segment] == NOT_SPILLED) {
+        m_spillOffsets[segment] = m_spillFile.append(m_segments[segment], segmentBytes());
+    }
+    
+    m_freeSegments.push_back(m_segments[segment]);
+    m_segments[segment] = nullptr;
+    m_residentSegments[residentSlot] = m_residentSegments.back();
+    m_residentSegments.pop_back();
+}
+
+std::size_t SortTrace::keyframeBytes(std::size_t count) const {
+    return count * (m_initialState.size() + m_auxiliarySize) * sizeof(int);
+}
+
+void SortTrace::addKeyframe(const Array& state, const Array& auxiliary) {
+    int* values;
+    if (!m_freeKeyframes.empty()) {
+        values = m_freeKeyframes.back();
+        m_freeKeyframes.pop_back();
+    } else {
+        values = m_arena.allocateArray<int>(m_initialState.size() + m_auxiliarySize);
+    }
+    
+    ArrayKernels::copy(values, state.data(), state.size());
+    ArrayKernels::copy(values + m_initialState.size(), auxiliary.data(), auxiliary.size());
+    m_keyframes.push_back(values);
+}
+
+void SortTrace::thinKeyframes() {
+    while (m_keyframes.size() > 1 && keyframeBytes(m_keyframes.size()) > m_keyframeBudget) {
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_keyframes.size(); ++i) {
+            if (i % 2 == 0) {
+                m_keyframes[kept++] = m_keyframes[i];
+            } else {
+                m_freeKeyframes.push_back(m_keyframes[i]);
+            }
+        }
+        m_keyframes.resize(kept);
+        m_keyframeInterval *= 2;
+    }
+}
+
+void SortTrace::rebuildKeyframes() {
+    std::size_t interval = Config::TRACE_MIN_KEYFRAME_INTERVAL;
+    while (interval < m_size &&
+           keyframeBytes(m_size / interval + 1) > m_keyframeBudget) {
+        interval *= 2;
+    }
+    
+    m_keyframeInterval = interval;
+    m_freeKeyframes.insert(m_freeKeyframes.end(), m_keyframes.begin(), m_keyframes.end());
+    m_keyframes.clear();
+    
+    Array state = m_initialState;
+    Array auxiliary(m_auxiliarySize);
+    addKeyframe(state, auxiliary);
+    for (std::size_t i = 0; i < m_size; ++i) {
+        applyDelta(state, auxiliary, deltaAt(i));
+        if ((i + 1) % m_keyframeInterval == 0) {
+            addKeyframe(state, auxiliary);
+        }
+    }
+    m_tipState = std::move(state);
+    m_tipAuxiliary = std::move(auxiliary);
+    thinKeyframes();
+}
+
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "SortStep.h"
+#include "TraceArena.h"
+#include "TraceIndex.h"
+#include "../../Array/Array.h"
+#include "../../../App/Config.h"
+#include "../../../Core/IO/MappedFile.h"
+#include "../../../Core/IO/SpillFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DSA {
+
+class SortTrace {
+public:
+    SortTrace();
+    explicit SortTrace(const Array& initialState, std::size_t auxiliarySize = 0);
+    SortTrace(const Array& initialState, std::size_t auxiliarySize, std::unique_ptr<MappedFile> mapping,
+              const SortStep* steps, std::size_t stepCount);
+    
+    SortTrace(SortTrace&& other) noexcept = default;
+    SortTrace& operator=(SortTrace&& other) noexcept = default;
+    
+    void push(SortStep step);
+    void clear();
+    
+    std::size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    
+    SortStep operator[](std::size_t index) const { return stepAt(index); }
+    SortStep back() const { return stepAt(m_size - 1); }
+    StepDelta deltaAt(std::size_t index) const { return stepAt(index).delta; }
+    
+    const Array& getInitialState() const { return m_initialState; }
+    std::size_t getAuxiliarySize() const noexcept { return m_auxiliarySize; }
+    Array stateAt(std::size_t index) const;
+    void restoreState(std::size_t index, Array& out) const;
+    void restoreState(std::size_t index, Array& out, Array& auxiliary) const;
+    
+    void setKeyframeBudget(std::size_t budgetBytes);
+    std::size_t getKeyframeBudget() const noexcept { return m_keyframeBudget; }
+    std::size_t getKeyframeInterval() const noexcept { return m_keyframeInterval; }
+    std::size_t getKeyframeCount() const noexcept { return m_keyframes.size(); }
+    
+    void setMemoryBudget(std::size_t budgetBytes);
+    std::size_t getMemoryBudget() const noexcept { return m_memoryBudget; }
+    std::size_t getResidentBytes() const noexcept { return m_residentSegments.size() * segmentBytes(); }
+    std::uint64_t getSpilledBytes() const noexcept { return m_spillFile.size(); }
+    
+    const TraceArena& getArena() const noexcept { return m_arena; }
+    bool isMapped() const noexcept { return m_mappedSteps != nullptr; }
+    const TraceIndex& getIndex() const noexcept { return m_index; }
+    
+    static void applyDelta(Array& array, Array& auxiliary, const StepDelta& delta);
+    static void revertDelta(Array& array, Array& auxiliary, const StepDelta& delta);
+
+private:
+    Array m_initialState;
+    std::size_t m_auxiliarySize;
+    Array m_tipState;
+    Array m_tipAuxiliary;
+    mutable TraceArena m_arena;
+    mutable std::vector<SortStep*> m_segments;
+    mutable std::vector<std::size_t> m_segmentUses;
+    mutable std::vector<std::size_t> m_residentSegments;
+    mutable std::vector<SortStep*> m_freeSegments;
+    mutable std::size_t m_useCounter;
+    mutable std::vector<std::uint64_t> m_spillOffsets;
+    mutable SpillFile m_spillFile;
+    std::size_t m_memoryBudget;
+    std::size_t m_size;
+    std::unique_ptr<MappedFile> m_mapping;
+    const SortStep* m_mappedSteps;
+    TraceIndex m_index;
+    std::vector<int*> m_keyframes;
+    std::vector<int*> m_freeKeyframes;
+    std::size_t m_keyframeInterval;
+    std::size_t m_keyframeBudget;
+    
+    static constexpr std::uint64_t NOT_SPILLED = UINT64_MAX;
+    
+    static constexpr std::size_t segmentBytes() noexcept { return Config::TRACE_STEP_SEGMENT_SIZE * sizeof(SortStep); }
+    const SortStep& stepAt(std::size_t index) const {
+        if (m_mappedSteps) {
+            return m_mappedSteps[index];
+        }
+        std::size_t segment = index / Config::TRACE_STEP_SEGMENT_SIZE;
+        const SortStep* steps = m_segments[segment];
+        if (!steps) {
+            steps = pageIn(segment);
+        }
+        m_segmentUses[segment] = ++m_useCounter;
+        return steps[index % Config::TRACE_STEP_SEGMENT_SIZE];
+    }
+    std::size_t maxResidentSegments() const noexcept;
+    SortStep* acquireSegment() const;
+    SortStep* pageIn(std::size_t segment) const;
+    void trimResident(std::size_t reserve) const;
+    void evictSegment(std::size_t residentSlot) const;
+    std::size_t keyframeBytes(std::size_t count) const;
+    void addKeyframe(const Array& state, const Array& auxiliary);
+    void thinKeyframes();
+    void rebuildKeyframes();
+};
+
+}
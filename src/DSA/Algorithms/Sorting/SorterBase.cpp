@@ -1,39 +1,17 @@
 #include "SorterBase.h"
+#include <utility>
 
 namespace DSA {
 
-SortStep SorterBase::createCompareStep(const Array& array,
-                                       const std::vector<std::size_t>& indices,
-                                       const std::string& message) const {
-    return SortStep(StepType::Compare, indices, message, array);
-}
-
-SortStep SorterBase::createSwapStep(const Array& array,
-                                    std::size_t i,
-                                    std::size_t j,
-                                    const std::string& message) const {
-    Array swappedArray = array;
-    swappedArray.swap(i, j);
+SortTrace SorterBase::sort(const Array& array) const {
+    SortTrace trace(array, getAuxiliarySize(array.size()));
+    std::unique_ptr<StepGenerator> generator = createGenerator(array);
     
-    std::vector<std::size_t> indices = {i, j};
-    return SortStep(StepType::Swap, indices, message, swappedArray);
-}
-
-SortStep SorterBase::createHighlightStep(const Array& array,
-                                         const std::vector<std::size_t>& indices,
-                                         const std::string& message) const {
-    return SortStep(StepType::Highlight, indices, message, array);
-}
-
-SortStep SorterBase::createHighlightStep(const Array& array,
-                                         const std::vector<std::size_t>& indices,
-                                         const std::map<std::size_t, ElementRole>& roles,
-                                         const std::string& message) const {
-    return SortStep(StepType::Highlight, indices, roles, message, array);
-}
-
-SortStep SorterBase::createCompleteStep(const Array& array) const {
-    return SortStep(StepType::Complete, {}, "Sorting completed", array);
+    SortStep step;
+    while (generator->next(step)) {
+        trace.push(std::move(step));
+    }
+    return trace;
 }
 
 }
@@ -1,42 +1,104 @@
 #pragma once
 
 #include "SortStep.h"
+#include "SortStats.h"
+#include "SortTrace.h"
+#include "StepGenerator.h"
+#include "Recorder.h"
 #include "../../Array/Array.h"
 #include <string>
-#include <vector>
-#include <map>
+#include <memory>
+#include <utility>
 
 namespace DSA {
 
 class SorterBase {
 public:
     virtual ~SorterBase() = default;
-    virtual std::vector<SortStep> sort(const Array& array) = 0;
+    virtual std::unique_ptr<StepGenerator> createGenerator(ArrayView array) const = 0;
+    virtual std::unique_ptr<StepGenerator> createGenerator(Int64ArrayView array, const KeyProjection& projection) const = 0;
+    virtual std::unique_ptr<StepGenerator> createGenerator(FloatArrayView array, const KeyProjection& projection) const = 0;
+    virtual std::unique_ptr<StepGenerator> createGenerator(DoubleArrayView array, const KeyProjection& projection) const = 0;
+    virtual std::unique_ptr<StepGenerator> createGenerator(RecordArrayView array, const KeyProjection& projection) const = 0;
+    virtual SortStats countOperations(ArrayView array) const = 0;
+    virtual SortStats countOperations(Int64ArrayView array) const = 0;
+    virtual SortStats countOperations(FloatArrayView array) const = 0;
+    virtual SortStats countOperations(DoubleArrayView array) const = 0;
+    virtual SortStats countOperations(RecordArrayView array) const = 0;
+    virtual void sortInPlace(Array& array) const = 0;
+    virtual void sortInPlace(Int64Array& array) const = 0;
+    virtual void sortInPlace(FloatArray& array) const = 0;
+    virtual void sortInPlace(DoubleArray& array) const = 0;
+    virtual void sortInPlace(RecordArray& array) const = 0;
     virtual std::string getName() const = 0;
     virtual std::string getDescription() const = 0;
     virtual std::string getTimeComplexity() const = 0;
     virtual std::string getSpaceComplexity() const = 0;
+    virtual std::size_t getAuxiliarySize(std::size_t elementCount) const { (void)elementCount; return 0; }
+    
+    SortTrace sort(const Array& array) const;
+};
+
+template <template <typename> class Algorithm>
+class AlgorithmSorter : public SorterBase {
+public:
+    std::unique_ptr<StepGenerator> createGenerator(ArrayView array) const override {
+        return generatorFor(array, KeyProjection());
+    }
+    
+    std::unique_ptr<StepGenerator> createGenerator(Int64ArrayView array, const KeyProjection& projection) const override {
+        return generatorFor(array, projection);
+    }
+    
+    std::unique_ptr<StepGenerator> createGenerator(FloatArrayView array, const KeyProjection& projection) const override {
+        return generatorFor(array, projection);
+    }
+    
+    std::unique_ptr<StepGenerator> createGenerator(DoubleArrayView array, const KeyProjection& projection) const override {
+        return generatorFor(array, projection);
+    }
+    
+    std::unique_ptr<StepGenerator> createGenerator(RecordArrayView array, const KeyProjection& projection) const override {
+        return generatorFor(array, projection);
+    }
+    
+    SortStats countOperations(ArrayView array) const override { return countElements(array); }
+    SortStats countOperations(Int64ArrayView array) const override { return countElements(array); }
+    SortStats countOperations(FloatArrayView array) const override { return countElements(array); }
+    SortStats countOperations(DoubleArrayView array) const override { return countElements(array); }
+    SortStats countOperations(RecordArrayView array) const override { return countElements(array); }
+    
+    void sortInPlace(Array& array) const override { sortElements(array); }
+    void sortInPlace(Int64Array& array) const override { sortElements(array); }
+    void sortInPlace(FloatArray& array) const override { sortElements(array); }
+    void sortInPlace(DoubleArray& array) const override { sortElements(array); }
+    void sortInPlace(RecordArray& array) const override { sortElements(array); }
 
-protected:
-    SortStep createCompareStep(const Array& array, 
-                               const std::vector<std::size_t>& indices,
-                               const std::string& message) const;
-    
-    SortStep createSwapStep(const Array& array,
-                           std::size_t i,
-                           std::size_t j,
-                           const std::string& message) const;
-    
-    SortStep createHighlightStep(const Array& array,
-                                const std::vector<std::size_t>& indices,
-                                const std::string& message) const;
-    
-    SortStep createHighlightStep(const Array& array,
-                                const std::vector<std::size_t>& indices,
-                                const std::map<std::size_t, ElementRole>& roles,
-                                const std::string& message) const;
-    
-    SortStep createCompleteStep(const Array& array) const;
+private:
+    template <typename T>
+    static std::unique_ptr<StepGenerator> generatorFor(BasicArrayView<T> array, const KeyProjection& projection) {
+        return std::make_unique<AlgorithmStepGenerator<Algorithm<T>>>(array, projection);
+    }
+    
+    template <typename T>
+    static SortStats countElements(BasicArrayView<T> array) {
+        BasicArray<T> working(array);
+        Algorithm<T> algorithm(std::move(working));
+        CountingRecorder recorder;
+        algorithm.run(recorder);
+        return recorder.getStats();
+    }
+    
+    template <typename T>
+    static void sortElements(BasicArray<T>& array) {
+        if (array.isSorted()) {
+            return;
+        }
+        Algorithm<T> algorithm(std::move(array));
+        NullRecorder recorder;
+        algorithm.run(recorder);
+        array = algorithm.takeArray();
+    }
 };
 
 }
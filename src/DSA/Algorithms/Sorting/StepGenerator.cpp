@@ -0,0 +1,29 @@
+#include "StepGenerator.h"
+#include <utility>
+
+namespace DSA {
+
+StepGenerator::StepGenerator()
+    : m_recorder()
+    , m_pendingHead(0)
+    , m_finished(false)
+{
+}
+
+bool StepGenerator::next(SortStep& step) {
+    std::vector<SortStep>& pending = m_recorder.getSteps();
+    while (m_pendingHead == pending.size()) {
+        pending.clear();
+        m_pendingHead = 0;
+        
+        if (m_finished) {
+            return false;
+        }
+        m_finished = !produce(m_recorder);
+    }
+    
+    step = std::move(pending[m_pendingHead++]);
+    return true;
+}
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "SortStep.h"
+#include "SortStats.h"
+#include "Recorder.h"
+#include "../../Array/Array.h"
+#include "../../Array/KeyProjection.h"
+#include <cstddef>
+#include <vector>
+
+namespace DSA {
+
+class StepGenerator {
+public:
+    virtual ~StepGenerator() = default;
+    
+    bool next(SortStep& step);
+    bool isFinished() const noexcept { return m_finished && m_pendingHead == m_recorder.getSteps().size(); }
+    
+    const SortStats& getStats() const noexcept { return m_recorder.getStats(); }
+
+protected:
+    StepGenerator();
+    
+    virtual bool produce(TraceRecorder& recorder) = 0;
+
+private:
+    TraceRecorder m_recorder;
+    std::size_t m_pendingHead;
+    bool m_finished;
+};
+
+template <typename Algorithm>
+class AlgorithmStepGenerator : public StepGenerator {
+public:
+    template <typename T>
+    AlgorithmStepGenerator(BasicArrayView<T> array, const KeyProjection& projection)
+        : StepGenerator()
+        , m_algorithm(BasicArray<T>(array))
+    {
+        m_algorithm.setProjection(projection);
+    }
+
+protected:
+    bool produce(TraceRecorder& recorder) override {
+        m_algorithm.produce(recorder);
+        return !m_algorithm.isFinished();
+    }
+
+private:
+    Algorithm m_algorithm;
+};
+
+}
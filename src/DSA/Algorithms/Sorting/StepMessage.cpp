@@ -0,0 +1,121 @@
+#include "StepMessage.h"
+#include <sstream>
+
+namespace DSA {
+
+std::string formatMessage(const StepMessage& message) {
+    const std::int64_t* a = message.args;
+    std::ostringstream msg;
+    
+    switch (message.id) {
+        case MessageID::Completed:
+            msg << "Sorting completed";
+            break;
+            
+        case MessageID::CompareAdjacent:
+            msg << "Comparing elements at indices " << a[0] << " and " << a[1]
+                << " (values: " << a[2] << " and " << a[3] << ")";
+            break;
+            
+        case MessageID::SwapAdjacent:
+            msg << "Swapping elements at indices " << a[0] << " and " << a[1]
+                << " (" << a[2] << " > " << a[3] << ")";
+            break;
+            
+        case MessageID::PassComplete:
+            msg << "Pass " << a[0] << " complete. Element at index "
+                << a[1] << " is in its final position.";
+            break;
+            
+        case MessageID::SelectKey:
+            msg << "Selecting element at index " << a[0]
+                << " (value: " << a[1] << ") to insert";
+            break;
+            
+        case MessageID::CompareWithKey:
+            msg << "Comparing element at index " << a[0]
+                << " (value: " << a[1]
+                << ") with key (value: " << a[2] << ")";
+            break;
+            
+        case MessageID::ShiftElement:
+            msg << "Shifting element at index " << a[0]
+                << " to index " << a[1];
+            break;
+            
+        case MessageID::InsertKey:
+            msg << "Inserting key at index " << a[0];
+            break;
+            
+        case MessageID::SortedPrefix:
+            msg << "Elements up to index " << a[0] << " are now sorted";
+            break;
+            
+        case MessageID::StartMinimumSearch:
+            msg << "Starting pass " << a[0] << ", searching for minimum from index " << a[1];
+            break;
+            
+        case MessageID::CompareWithMinimum:
+            msg << "Comparing element at index " << a[0]
+                << " (value: " << a[1]
+                << ") with minimum at index " << a[2]
+                << " (value: " << a[3] << ")";
+            break;
+            
+        case MessageID::NewMinimum:
+            msg << "New minimum found at index " << a[0]
+                << " (value: " << a[1] << ")";
+            break;
+            
+        case MessageID::SwapMinimum:
+            msg << "Swapping minimum at index " << a[0]
+                << " (value: " << a[1]
+                << ") with element at index " << a[2]
+                << " (value: " << a[3] << ")";
+            break;
+            
+        case MessageID::AlreadyInPlace:
+            msg << "Element at index " << a[0]
+                << " is already in correct position";
+            break;
+            
+        case MessageID::CopyToAuxiliary:
+            msg << "Copying element at index " << a[0]
+                << " (value: " << a[1] << ") into the auxiliary buffer";
+            break;
+            
+        case MessageID::CompareMerge:
+            msg << "Comparing buffered elements at indices " << a[0] << " and " << a[1]
+                << " (values: " << a[2] << " and " << a[3] << ")";
+            break;
+            
+        case MessageID::MergeTake:
+            msg << "Writing buffered element from index " << a[0]
+                << " (value: " << a[1] << ") to index " << a[2];
+            break;
+            
+        case MessageID::MergeComplete:
+            msg << "Merged indices " << a[0] << " to " << a[1] << " into one sorted run";
+            break;
+            
+        case MessageID::MergeWidthComplete:
+            msg << "All runs of width " << a[0] << " merged";
+            break;
+            
+        case MessageID::RunBoundary:
+            msg << "Ascending run ends at index " << a[0]
+                << " (" << a[1] << " > " << a[2] << ")";
+            break;
+            
+        case MessageID::RunsRemaining:
+            msg << "Merge pass " << a[0] << " complete, " << a[1] << " sorted runs remain";
+            break;
+            
+        default:
+            break;
+    }
+    
+    return msg.str();
+}
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace DSA {
+
+enum class MessageID : std::uint8_t {
+    None = 0,
+    Completed,
+    CompareAdjacent,
+    SwapAdjacent,
+    PassComplete,
+    SelectKey,
+    CompareWithKey,
+    ShiftElement,
+    InsertKey,
+    SortedPrefix,
+    StartMinimumSearch,
+    CompareWithMinimum,
+    NewMinimum,
+    SwapMinimum,
+    AlreadyInPlace,
+    CopyToAuxiliary,
+    CompareMerge,
+    MergeTake,
+    MergeComplete,
+    MergeWidthComplete,
+    RunBoundary,
+    RunsRemaining
+};
+
+struct StepMessage {
+    MessageID id;
+    std::uint8_t padding[alignof(std::int64_t) - 1];
+    std::int64_t args[4];
+    
+    StepMessage(MessageID messageId = MessageID::None,
+                std::int64_t first = 0,
+                std::int64_t second = 0,
+                std::int64_t third = 0,
+                std::int64_t fourth = 0)
+        : id(messageId)
+        , padding()
+        , args{first, second, third, fourth}
+    {}
+};
+
+std::string formatMessage(const StepMessage& message);
+
+}
@@ -0,0 +1,78 @@
+#include "TopDownMergeSort.h"
+#include "../../Array/Array.h"
+#include <utility>
+
+namespace DSA {
+
+template <typename T>
+TopDownMergeSortAlgorithm<T>::TopDownMergeSortAlgorithm(BasicArray<T> array)
+    : MergeSortAlgorithm<T>(std::move(array))
+    , m_frames()
+{
+    m_frames.push_back(Frame{0, this->m_size, 0});
+}
+
+template <typename T>
+bool TopDownMergeSortAlgorithm<T>::nextMerge(MergeRange& range) {
+    while (!m_frames.empty()) {
+        Frame frame = m_frames.back();
+        if (frame.end - frame.begin < 2) {
+            m_frames.pop_back();
+            continue;
+        }
+        
+        std::size_t middle = frame.begin + (frame.end - frame.begin) / 2;
+        if (frame.stage == 0) {
+            m_frames.back().stage = 1;
+            m_frames.push_back(Frame{frame.begin, middle, 0});
+        } else if (frame.stage == 1) {
+            m_frames.back().stage = 2;
+            m_frames.push_back(Frame{middle, frame.end, 0});
+        } else {
+            m_frames.pop_back();
+            range = MergeRange{frame.begin, middle, frame.end};
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+template <typename Recorder>
+void TopDownMergeSortAlgorithm<T>::produce(Recorder& recorder) {
+    if (this->isMerging()) {
+        this->produceMerge(recorder);
+        return;
+    }
+    
+    MergeRange range;
+    if (!nextMerge(range)) {
+        this->produceCompletion(recorder);
+        return;
+    }
+    
+    this->beginMerge(range);
+    this->produceMerge(recorder);
+}
+
+template <typename T>
+template <typename Recorder>
+void TopDownMergeSortAlgorithm<T>::run(Recorder& recorder) {
+    while (!this->isFinished()) {
+        produce(recorder);
+    }
+}
+
+DSA_INSTANTIATE_SORT_ALGORITHM(TopDownMergeSortAlgorithm, int);
+DSA_INSTANTIATE_SORT_ALGORITHM(TopDownMergeSortAlgorithm, std::int64_t);
+DSA_INSTANTIATE_SORT_ALGORITHM(TopDownMergeSortAlgorithm, float);
+DSA_INSTANTIATE_SORT_ALGORITHM(TopDownMergeSortAlgorithm, double);
+DSA_INSTANTIATE_SORT_ALGORITHM(TopDownMergeSortAlgorithm, KeyedRecord);
+
+std::string TopDownMergeSort::getDescription() const {
+    return "Top-Down Merge Sort recursively splits the array in half, sorts each half "
+           "and merges them back through an auxiliary buffer of the same size. "
+           "It is stable and always takes O(n log n) time, paying O(n) extra memory.";
+}
+
+}
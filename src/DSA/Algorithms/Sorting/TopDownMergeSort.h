@@ -0,0 +1,55 @@
+#pragma once
+
+#include "MergeSort.h"
+#include <vector>
+
+namespace DSA {
+
+
+template <typename T>
+class TopDownMergeSortAlgorithm : public MergeSortAlgorithm<T> {
+public:
+    
+    explicit TopDownMergeSortAlgorithm(BasicArray<T> array);
+    
+    
+    template <typename Recorder>
+    void produce(Recorder& recorder);
+    
+    
+    template <typename Recorder>
+    void run(Recorder& recorder);
+
+private:
+    
+    using MergeRange = typename MergeSortAlgorithm<T>::MergeRange;
+    
+    struct Frame {
+        std::size_t begin;
+        std::size_t end;
+        std::uint8_t stage;
+    };
+    
+    
+    bool nextMerge(MergeRange& range);
+    
+    std::vector<Frame> m_frames;
+};
+
+
+class TopDownMergeSort : public MergeSorter<TopDownMergeSortAlgorithm> {
+public:
+    
+    TopDownMergeSort() = default;
+    
+    
+    virtual ~TopDownMergeSort() = default;
+    
+    
+    std::string getName() const override { return "Top-Down Merge Sort"; }
+    
+    
+    std::string getDescription() const override;
+};
+
+}
@@ -0,0 +1,136 @@
+#include "TraceArena.h"
+#include "../../../App/Config.h"
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace DSA {
+
+static constexpr std::size_t BLOCK_HEADER_SIZE = alignof(std::max_align_t) > sizeof(void*)
+    ? alignof(std::max_align_t) : sizeof(void*);
+
+TraceArena::TraceArena()
+    : m_head(nullptr)
+    , m_cursor(nullptr)
+    , m_limit(nullptr)
+    , m_nextBlockSize(Config::TRACE_ARENA_INITIAL_BLOCK_BYTES)
+    , m_blockCount(0)
+    , m_reservedBytes(0)
+    , m_usedBytes(0)
+{
+}
+
+TraceArena::~TraceArena() {
+    release();
+}
+
+TraceArena::TraceArena(TraceArena&& other) noexcept
+    : m_head(other.m_head)
+    , m_cursor(other.m_cursor)
+    , m_limit(other.m_limit)
+    , m_nextBlockSize(other.m_nextBlockSize)
+    , m_blockCount(other.m_blockCount)
+    , m_reservedBytes(other.m_reservedBytes)
+    , m_usedBytes(other.m_usedBytes)
+{
+    other.m_head = nullptr;
+    other.m_cursor = nullptr;
+    other.m_limit = nullptr;
+    other.m_nextBlockSize = Config::TRACE_ARENA_INITIAL_BLOCK_BYTES;
+    other.m_blockCount = 0;
+    other.m_reservedBytes = 0;
+    other.m_usedBytes = 0;
+}
+
+TraceArena& TraceArena::operator=(TraceArena&& other) noexcept {
+    if (this != &other) {
+        release();
+        std::swap(m_head, other.m_head);
+        std::swap(m_cursor, other.m_cursor);
+        std::swap(m_limit, other.m_limit);
+        std::swap(m_nextBlockSize, other.m_nextBlockSize);
+        std::swap(m_blockCount, other.m_blockCount);
+        std::swap(m_reservedBytes, other.m_reservedBytes);
+        std::swap(m_usedBytes, other.m_usedBytes);
+    }
+    return *this;
+}
+
+void* TraceArena::allocate(std::size_t bytes, std::size_t alignment) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(m_cursor);
+    std::uintptr_t aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    
+    if (!m_cursor || aligned + bytes > reinterpret_cast<std::uintptr_t>(m_limit)) {
+        addBlock(bytes + alignment);
+        address = reinterpret_cast<std::uintptr_t>(m_cursor);
+        aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    }
+    
+    m_cursor = reinterpret_cast<char*>(aligned + bytes);
+    m_usedBytes += bytes;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void TraceArena::release() noexcept {
+    while (m_head) {
+        Block* next = m_head->next;
+        std::free(m_head);
+        m_head = next;
+    }
+    
+    m_cursor = nullptr;
+    m_limit = nullptr;
+    m_nextBlockSize = Config::TRACE_ARENA_INITIAL_BLOCK_BYTES;
+    m_blockCount = 0;
+    m_reservedBytes = 0;
+    m_usedBytes = 0;
+}
+
+void TraceArena::addBlock(std::size_t minBytes) {
+    std::size_t size = m_nextBlockSize;
+    while (size < minBytes) {
+        size *= 2;
+    }
+    
+    void* memory = std::malloc(BLOCK_HEADER_SIZE + size);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    
+    Block* block = static_cast<Block*>(memory);
+    block->next = m_head;
+    m_head = block;
+    m_cursor = static_cast<char*>(memory) + BLOCK_HEADER_SIZE;
+    m_limit = m_cursor + size;
+    
+    ++m_blockCount;
+    m_reservedBytes += size;
+    if (m_nextBlockSize < Config::TRACE_ARENA_MAX_BLOCK_BYTES) {
+        m_nextBlockSize *= 2;
+    }
+}
+
+void* TraceArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    return allocate(bytes, alignment);
+}
+
+void TraceArena::do_deallocate(void*, std::size_t, std::size_t) {
+}
+
+bool TraceArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+bool TraceArena::doResize(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t) {
+    char* start = static_cast<char*>(block);
+    if (start + oldBytes != m_cursor || newBytes > static_cast<std::size_t>(m_limit - start)) {
+        return false;
+    }
+    
+    m_cursor = start + newBytes;
+    m_usedBytes += newBytes - oldBytes;
+    return true;
+}
+
+}
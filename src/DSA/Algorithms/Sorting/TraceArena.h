@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../../Array/ResizableResource.h"
+#include <cstddef>
+
+namespace DSA {
+
+class TraceArena : public ResizableResource {
+public:
+    TraceArena();
+    ~TraceArena();
+    
+    TraceArena(const TraceArena&) = delete;
+    TraceArena& operator=(const TraceArena&) = delete;
+    
+    TraceArena(TraceArena&& other) noexcept;
+    TraceArena& operator=(TraceArena&& other) noexcept;
+    
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    
+    template <typename T>
+    T* allocateArray(std::size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+    
+    void release() noexcept;
+    
+    std::size_t getBlockCount() const noexcept { return m_blockCount; }
+    std::size_t getReservedBytes() const noexcept { return m_reservedBytes; }
+    std::size_t getUsedBytes() const noexcept { return m_usedBytes; }
+
+private:
+    struct Block {
+        Block* next;
+    };
+    
+    Block* m_head;
+    char* m_cursor;
+    char* m_limit;
+    std::size_t m_nextBlockSize;
+    std::size_t m_blockCount;
+    std::size_t m_reservedBytes;
+    std::size_t m_usedBytes;
+    
+    void addBlock(std::size_t minBytes);
+    
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    bool doResize(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) override;
+};
+
+}
@@ -0,0 +1,190 @@
+#include "TraceCache.h"
+#include "TraceFile.h"
+#include "../../../App/Config.h"
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace DSA {
+
+static constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+static std::uint64_t hashBytes(std::uint64_t hash, const unsigned char* bytes, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= count; i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash ^= word;
+        hash *= FNV_PRIME;
+        hash ^= hash >> 32;
+    }
+    for (; i < count; ++i) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+TraceCache& TraceCache::getInstance() {
+    static TraceCache instance;
+    return instance;
+}
+
+TraceCache::TraceCache()
+    : m_entries()
+    , m_budget(Config::TRACE_CACHE_BUDGET_BYTES)
+    , m_residentBytes(0)
+    , m_directory(Config::TRACE_CACHE_DIRECTORY)
+{
+}
+
+TraceCache::Key TraceCache::makeKey(const std::string& algorithm, ArrayView input) {
+    return makeKey(algorithm, hashInput(input), input.size());
+}
+
+TraceCache::Key TraceCache::makeKey(const std::string& algorithm, std::uint64_t inputHash, std::size_t elementCount) {
+    Key key;
+    key.algorithm = algorithm;
+    key.inputHash = inputHash;
+    key.elementCount = elementCount;
+    return key;
+}
+
+std::uint64_t TraceCache::hashInput(ArrayView input) {
+    return hashInput(input.data(), input.size() * sizeof(int));
+}
+
+std::uint64_t TraceCache::hashInput(const void* data, std::size_t bytes) {
+    return hashBytes(FNV_OFFSET_BASIS, static_cast<const unsigned char*>(data), bytes);
+}
+
+bool TraceCache::take(const Key& key, ArrayView input, SortTrace& out) {
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->key == key) {
+            if (!matchesInput(it->trace, input)) {
+                return false;
+            }
+            m_residentBytes -= it->bytes;
+            out = std::move(it->trace);
+            m_entries.erase(it);
+            return true;
+        }
+    }
+    
+    return takeFromDisk(key, input, out);
+}
+
+void TraceCache::store(const Key& key, SortTrace trace) {
+    if (!key.isValid() || trace.empty()) {
+        return;
+    }
+    
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->key == key) {
+            m_residentBytes -= it->bytes;
+            m_entries.erase(it);
+            break;
+        }
+    }
+    
+    std::size_t bytes = traceBytes(trace);
+    if (bytes > m_budget) {
+        writeToDisk(key, trace);
+        return;
+    }
+    
+    evictTo(m_budget - bytes);
+    m_entries.push_front(Entry{key, std::move(trace), bytes});
+    m_residentBytes += bytes;
+}
+
+void TraceCache::clear() {
+    m_entries.clear();
+    m_residentBytes = 0;
+}
+
+void TraceCache::setBudget(std::size_t budgetBytes) {
+    m_budget = budgetBytes;
+    evictTo(m_budget);
+}
+
+void TraceCache::setDirectory(const std::string& directory) {
+    m_directory = directory;
+}
+
+std::size_t TraceCache::traceBytes(const SortTrace& trace) {
+    return trace.getArena().getReservedBytes()
+         + (trace.getInitialState().size() + trace.getAuxiliarySize()) * sizeof(int);
+}
+
+bool TraceCache::matchesInput(const SortTrace& trace, ArrayView input) {
+    return trace.getInitialState().view() == input;
+}
+
+std::string TraceCache::diskPath(const Key& key) const {
+    std::uint64_t nameHash = hashBytes(FNV_OFFSET_BASIS, reinterpret_cast<const unsigned char*>(key.algorithm.data()),
+                                       key.algorithm.size());
+    
+    std::ostringstream path;
+    path << m_directory << '/' << std::hex << std::setfill('0')
+         << std::setw(16) << nameHash << '-' << std::setw(16) << key.inputHash
+         << std::dec << '-' << key.elementCount << TraceFile::EXTENSION;
+    return path.str();
+}
+
+bool TraceCache::takeFromDisk(const Key& key, ArrayView input, SortTrace& out) const {
+    if (m_directory.empty()) {
+        return false;
+    }
+    
+    std::string path = diskPath(key);
+    if (!std::ifstream(path, std::ios::binary)) {
+        return false;
+    }
+    
+    try {
+        std::string algorithmName;
+        SortTrace trace = TraceFile::open(path, algorithmName);
+        if (algorithmName != key.algorithm || !matchesInput(trace, input)) {
+            return false;
+        }
+        out = std::move(trace);
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to read cached trace: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void TraceCache::writeToDisk(const Key& key, const SortTrace& trace) const {
+    if (m_directory.empty()) {
+        return;
+    }
+    
+    std::string path = diskPath(key);
+    if (std::ifstream(path, std::ios::binary)) {
+        return;
+    }
+    
+    try {
+        TraceFile::write(path, trace, key.algorithm);
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to write cached trace: " << e.what() << std::endl;
+    }
+}
+
+void TraceCache::evictTo(std::size_t budgetBytes) {
+    while (!m_entries.empty() && m_residentBytes > budgetBytes) {
+        Entry& entry = m_entries.back();
+        writeToDisk(entry.key, entry.trace);
+        m_residentBytes -= entry.bytes;
+        m_entries.pop_back();
+    }
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "SortTrace.h"
+#include "../../Array/Array.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+
+namespace DSA {
+
+class TraceCache {
+public:
+    struct Key {
+        std::string algorithm;
+        std::uint64_t inputHash = 0;
+        std::size_t elementCount = 0;
+        
+        bool isValid() const noexcept { return !algorithm.empty(); }
+        bool operator==(const Key& other) const noexcept {
+            return inputHash == other.inputHash && elementCount == other.elementCount &&
+                   algorithm == other.algorithm;
+        }
+    };
+    
+    static TraceCache& getInstance();
+    static Key makeKey(const std::string& algorithm, ArrayView input);
+    static Key makeKey(const std::string& algorithm, std::uint64_t inputHash, std::size_t elementCount);
+    static std::uint64_t hashInput(ArrayView input);
+    static std::uint64_t hashInput(const void* data, std::size_t bytes);
+    
+    bool take(const Key& key, ArrayView input, SortTrace& out);
+    void store(const Key& key, SortTrace trace);
+    void clear();
+    
+    void setBudget(std::size_t budgetBytes);
+    std::size_t getBudget() const noexcept { return m_budget; }
+    std::size_t getResidentBytes() const noexcept { return m_residentBytes; }
+    std::size_t size() const noexcept { return m_entries.size(); }
+    
+    void setDirectory(const std::string& directory);
+    const std::string& getDirectory() const noexcept { return m_directory; }
+
+private:
+    struct Entry {
+        Key key;
+        SortTrace trace;
+        std::size_t bytes;
+    };
+    
+    TraceCache();
+    TraceCache(const TraceCache&) = delete;
+    TraceCache& operator=(const TraceCache&) = delete;
+    
+    std::list<Entry> m_entries;
+    std::size_t m_budget;
+    std::size_t m_residentBytes;
+    std::string m_directory;
+    
+    static std::size_t traceBytes(const SortTrace& trace);
+    static bool matchesInput(const SortTrace& trace, ArrayView input);
+    std::string diskPath(const Key& key) const;
+    bool takeFromDisk(const Key& key, ArrayView input, SortTrace& out) const;
+    void writeToDisk(const Key& key, const SortTrace& trace) const;
+    void evictTo(std::size_t budgetBytes);
+};
+
+}
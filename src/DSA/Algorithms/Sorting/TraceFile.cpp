@@ -0,0 +1,214 @@
+#include "TraceFile.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace DSA {
+
+static_assert(std::is_trivially_copyable<SortStep>::value, "SortStep must be trivially copyable");
+static_assert(std::has_unique_object_representations<SortStep>::value, "SortStep must not contain implicit padding");
+
+static constexpr char TRACE_MAGIC[8] = {'D', 'S', 'A', 'T', 'R', 'A', 'C', 'E'};
+static constexpr std::uint32_t TRACE_VERSION = 2;
+
+struct TraceFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t stepSize;
+    std::uint64_t stepCount;
+    std::uint64_t elementCount;
+    std::uint64_t auxiliaryCount;
+    std::uint64_t nameLength;
+    std::uint64_t stepsOffset;
+};
+
+static_assert(std::has_unique_object_representations<TraceFileHeader>::value,
+              "TraceFileHeader must not contain implicit padding");
+
+static std::uint64_t alignOffset(std::uint64_t offset, std::uint64_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+static bool isBuiltinAnnotation(AnnotationKey key) {
+    return key != AnnotationKey::None && key < AnnotationKey::FirstCustom;
+}
+
+static bool isValidRole(ElementRole role) {
+    return role <= ElementRole::Swapped;
+}
+
+static bool isValidBuffer(StepBuffer buffer) {
+    return buffer <= StepBuffer::Auxiliary;
+}
+
+static bool isValidStep(const SortStep& step, std::size_t elementCount, std::size_t auxiliaryCount) {
+    if (step.type > StepType::Complete || step.message.id > MessageID::RunsRemaining) {
+        return false;
+    }
+    if (!isValidBuffer(step.buffer) || !isValidBuffer(step.delta.buffer)) {
+        return false;
+    }
+    
+    std::size_t rowCount = step.buffer == StepBuffer::Auxiliary ? auxiliaryCount : elementCount;
+    if (step.indices.size() > IndexList::INLINE_CAPACITY) {
+        return false;
+    }
+    for (std::size_t index : step.indices) {
+        if (index >= rowCount) {
+            return false;
+        }
+    }
+    
+    if (step.roles.size() > RoleSet::INLINE_CAPACITY || !isValidRole(step.roles.getRangeRole())) {
+        return false;
+    }
+    for (const RoleSet::Entry& entry : step.roles) {
+        if (entry.index >= elementCount || !isValidRole(entry.role)) {
+            return false;
+        }
+    }
+    if (step.roles.hasRange() && step.roles.getRangeEnd() > elementCount) {
+        return false;
+    }
+    
+    if (step.annotations.size() > AnnotationSet::INLINE_CAPACITY) {
+        return false;
+    }
+    for (const AnnotationSet::Entry& entry : step.annotations) {
+        if (!isBuiltinAnnotation(entry.key)) {
+            return false;
+        }
+    }
+    
+    std::size_t targetCount = step.delta.buffer == StepBuffer::Auxiliary ? auxiliaryCount : elementCount;
+    switch (step.delta.type) {
+        case DeltaType::None:
+            return true;
+            
+        case DeltaType::Swap:
+            return step.delta.first < targetCount && step.delta.second < targetCount;
+            
+        case DeltaType::Write:
+            return step.delta.first < targetCount;
+            
+        default:
+            return false;
+    }
+}
+
+void TraceFile::write(const std::string& path, const SortTrace& trace, const std::string& algorithmName) {
+    const Array& initialState = trace.getInitialState();
+    
+    TraceFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header.version = TRACE_VERSION;
+    header.stepSize = sizeof(SortStep);
+    header.stepCount = trace.size();
+    header.elementCount = initialState.size();
+    header.auxiliaryCount = trace.getAuxiliarySize();
+    header.nameLength = algorithmName.size();
+    
+    std::uint64_t valuesEnd = sizeof(TraceFileHeader) + header.nameLength
+                            + header.elementCount * sizeof(std::int32_t);
+    header.stepsOffset = alignOffset(valuesEnd, alignof(SortStep));
+    
+    for (std::size_t i = 0; i < trace.size(); ++i) {
+        SortStep step = trace[i];
+        for (const AnnotationSet::Entry& entry : step.annotations) {
+            if (!isBuiltinAnnotation(entry.key)) {
+                throw std::runtime_error("Custom annotation keys cannot be saved to a trace file: " + path);
+            }
+        }
+    }
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Failed to create trace file: " + path);
+    }
+    
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(algorithmName.data(), static_cast<std::streamsize>(algorithmName.size()));
+    
+    std::vector<std::int32_t> values(initialState.size());
+    for (std::size_t i = 0; i < initialState.size(); ++i) {
+        values[i] = initialState[i];
+    }
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(std::int32_t)));
+    
+    const char padding[alignof(SortStep)] = {};
+    out.write(padding, static_cast<std::streamsize>(header.stepsOffset - valuesEnd));
+    
+    for (std::size_t i = 0; i < trace.size(); ++i) {
+        SortStep step = trace[i];
+        out.write(reinterpret_cast<const char*>(&step), sizeof(SortStep));
+    }
+    
+    if (!out) {
+        throw std::runtime_error("Failed to write trace file: " + path);
+    }
+}
+
+SortTrace TraceFile::open(const std::string& path, std::string& algorithmName) {
+    std::unique_ptr<MappedFile> mapping = std::make_unique<MappedFile>(path);
+    const char* data = mapping->data();
+    std::size_t size = mapping->size();
+    
+    TraceFileHeader header;
+    if (size < sizeof(header)) {
+        throw std::runtime_error("Trace file is truncated: " + path);
+    }
+    std::memcpy(&header, data, sizeof(header));
+    
+    if (std::memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        throw std::runtime_error("Not a trace file: " + path);
+    }
+    if (header.version != TRACE_VERSION || header.stepSize != sizeof(SortStep)) {
+        throw std::runtime_error("Unsupported trace file version: " + path);
+    }
+    
+    std::uint64_t available = size - sizeof(TraceFileHeader);
+    if (header.nameLength > available ||
+        header.elementCount > (available - header.nameLength) / sizeof(std::int32_t)) {
+        throw std::runtime_error("Trace file is truncated: " + path);
+    }
+    
+    std::uint64_t valuesEnd = sizeof(TraceFileHeader) + header.nameLength
+                            + header.elementCount * sizeof(std::int32_t);
+    if (header.auxiliaryCount > header.elementCount || header.stepsOffset < valuesEnd ||
+        header.stepsOffset % alignof(SortStep) != 0 ||
+        header.stepsOffset > size ||
+        header.stepCount > (size - header.stepsOffset) / sizeof(SortStep)) {
+        throw std::runtime_error("Trace file is truncated: " + path);
+    }
+    
+    const char* cursor = data + sizeof(TraceFileHeader);
+    algorithmName.assign(cursor, static_cast<std::size_t>(header.nameLength));
+    cursor += header.nameLength;
+    
+    Array initialState(static_cast<std::size_t>(header.elementCount));
+    for (std::size_t i = 0; i < initialState.size(); ++i) {
+        std::int32_t value;
+        std::memcpy(&value, cursor + i * sizeof(value), sizeof(value));
+        initialState[i] = value;
+    }
+    
+    const SortStep* steps = reinterpret_cast<const SortStep*>(data + header.stepsOffset);
+    std::size_t stepCount = static_cast<std::size_t>(header.stepCount);
+    std::size_t auxiliaryCount = static_cast<std::size_t>(header.auxiliaryCount);
+    for (std::size_t i = 0; i < stepCount; ++i) {
+        if (!isValidStep(steps[i], initialState.size(), auxiliaryCount)) {
+            throw std::runtime_error("Trace file has a corrupt step " + std::to_string(i) + ": " + path);
+        }
+    }
+    
+    return SortTrace(initialState, auxiliaryCount, std::move(mapping), steps, stepCount);
+}
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "SortTrace.h"
+#include <string>
+
+namespace DSA {
+
+class TraceFile {
+public:
+    static constexpr const char* EXTENSION = ".dsatrace";
+    
+    static void write(const std::string& path, const SortTrace& trace, const std::string& algorithmName);
+    static SortTrace open(const std::string& path, std::string& algorithmName);
+};
+
+}
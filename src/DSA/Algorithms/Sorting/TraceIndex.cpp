@@ -0,0 +1,59 @@
+#include "TraceIndex.h"
+#include <algorithm>
+
+namespace DSA {
+
+void TraceIndex::add(std::size_t position, const SortStep& step) {
+    for (std::size_t i = 0; i < static_cast<std::size_t>(TraceEvent::Count); ++i) {
+        if (matches(static_cast<TraceEvent>(i), step)) {
+            m_positions[i].push_back(position);
+        }
+    }
+}
+
+void TraceIndex::clear() {
+    for (std::vector<std::size_t>& list : m_positions) {
+        list.clear();
+    }
+}
+
+std::size_t TraceIndex::next(TraceEvent event, std::size_t position) const {
+    const std::vector<std::size_t>& list = positions(event);
+    auto it = std::upper_bound(list.begin(), list.end(), position);
+    return it != list.end() ? *it : NOT_FOUND;
+}
+
+std::size_t TraceIndex::previous(TraceEvent event, std::size_t position) const {
+    const std::vector<std::size_t>& list = positions(event);
+    auto it = std::lower_bound(list.begin(), list.end(), position);
+    return it != list.begin() ? *(it - 1) : NOT_FOUND;
+}
+
+bool TraceIndex::matches(TraceEvent event, const SortStep& step) {
+    switch (event) {
+        case TraceEvent::Swap:
+            return step.changesArray();
+            
+        case TraceEvent::PassBoundary:
+            if (step.type != StepType::Highlight) {
+                return false;
+            }
+            if (step.roles.hasRange() && step.roles.getRangeRole() == ElementRole::Sorted) {
+                return true;
+            }
+            for (const RoleSet::Entry& entry : step.roles) {
+                if (entry.role == ElementRole::Sorted) {
+                    return true;
+                }
+            }
+            return false;
+            
+        case TraceEvent::Complete:
+            return step.type == StepType::Complete;
+            
+        default:
+            return false;
+    }
+}
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "SortStep.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace DSA {
+
+enum class TraceEvent : std::uint8_t {
+    Swap = 0,
+    PassBoundary,
+    Complete,
+    Count
+};
+
+class TraceIndex {
+public:
+    static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+    
+    void add(std::size_t position, const SortStep& step);
+    void clear();
+    
+    std::size_t next(TraceEvent event, std::size_t position) const;
+    std::size_t previous(TraceEvent event, std::size_t position) const;
+    std::size_t count(TraceEvent event) const { return positions(event).size(); }
+    
+    static bool matches(TraceEvent event, const SortStep& step);
+
+private:
+    std::vector<std::size_t> m_positions[static_cast<std::size_t>(TraceEvent::Count)];
+    
+    const std::vector<std::size_t>& positions(TraceEvent event) const {
+        return m_positions[static_cast<std::size_t>(event)];
+    }
+};
+
+}
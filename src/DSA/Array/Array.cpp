@@ -1,133 +1,165 @@
 
 
 #include "Array.h"
+#include "ArrayKernels.h"
+#include "InputGenerator.h"
+#include "ResizableResource.h"
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <new>
 #include <stdexcept>
-#include <random>
 
 namespace DSA {
 
 static constexpr std::size_t INITIAL_CAPACITY = 8;
 static constexpr std::size_t GROWTH_FACTOR = 2;
 
-Array::Array()
+template <typename T>
+BasicArray<T>::BasicArray()
     : m_data(nullptr)
+    , m_header(nullptr)
+    , m_resource(nullptr)
     , m_size(0)
     , m_capacity(0)
 {
 }
 
-Array::Array(std::size_t size, int value)
+template <typename T>
+BasicArray<T>::BasicArray(std::size_t size, T value, std::pmr::memory_resource* resource)
     : m_data(nullptr)
+    , m_header(nullptr)
+    , m_resource(resource)
     , m_size(size)
     , m_capacity(size > 0 ? size : INITIAL_CAPACITY)
 {
     if (m_capacity > 0) {
         allocate(m_capacity);
-
-        for (std::size_t i = 0; i < m_size; ++i) {
-            m_data[i] = value;
-        }
+        ArrayKernels::fill(m_data, m_size, value);
     }
 }
 
-Array::Array(const Array& other)
+template <typename T>
+BasicArray<T>::BasicArray(BasicArrayView<T> view, std::pmr::memory_resource* resource)
     : m_data(nullptr)
-    , m_size(other.m_size)
-    , m_capacity(other.m_capacity)
+    , m_header(nullptr)
+    , m_resource(resource)
+    , m_size(0)
+    , m_capacity(0)
 {
-    if (m_capacity > 0 && m_size > 0) {
-        allocate(m_capacity);
+    assign(view);
+}
 
-        for (std::size_t i = 0; i < m_size; ++i) {
-            m_data[i] = other.m_data[i];
-        }
-    }
+template <typename T>
+BasicArray<T>::BasicArray(const BasicArray& other)
+    : m_data(nullptr)
+    , m_header(nullptr)
+    , m_resource(nullptr)
+    , m_size(0)
+    , m_capacity(0)
+{
+    share(other);
 }
 
-Array::Array(Array&& other) noexcept
+template <typename T>
+BasicArray<T>::BasicArray(BasicArray&& other) noexcept
     : m_data(other.m_data)
+    , m_header(other.m_header)
+    , m_resource(other.m_resource)
     , m_size(other.m_size)
     , m_capacity(other.m_capacity)
 {
     other.m_data = nullptr;
+    other.m_header = nullptr;
     other.m_size = 0;
     other.m_capacity = 0;
 }
 
-Array::~Array() {
+template <typename T>
+BasicArray<T>::~BasicArray() {
     deallocate();
 }
 
-Array& Array::operator=(const Array& other) {
+template <typename T>
+BasicArray<T>& BasicArray<T>::operator=(const BasicArray& other) {
     if (this != &other) {
-        m_size = other.m_size;
-
-        if (m_capacity < other.m_size) {
+        if (m_header == other.m_header) {
+            m_size = other.m_size;
+        } else {
             deallocate();
-            m_capacity = other.m_size > 0 ? other.m_size : 0;
-            if (m_capacity > 0) {
-                allocate(m_capacity);
-            }
-        }
-
-        if (m_size > 0 && m_data) {
-            for (std::size_t i = 0; i < m_size; ++i) {
-                m_data[i] = other.m_data[i];
-            }
+            share(other);
         }
     }
     return *this;
 }
 
-Array& Array::operator=(Array&& other) noexcept {
+template <typename T>
+BasicArray<T>& BasicArray<T>::operator=(BasicArray&& other) noexcept {
     if (this != &other) {
         deallocate();
         
         m_data = other.m_data;
+        m_header = other.m_header;
+        m_resource = other.m_resource;
         m_size = other.m_size;
         m_capacity = other.m_capacity;
         
         other.m_data = nullptr;
+        other.m_header = nullptr;
         other.m_size = 0;
         other.m_capacity = 0;
     }
     return *this;
 }
 
-int& Array::at(std::size_t index) {
+template <typename T>
+std::pair<T, T> BasicArray<T>::minMax(std::size_t begin, std::size_t end) const {
+    if (begin > end) {
+        throw std::out_of_range("Array minMax range is out of range");
+    }
+    return view().subview(begin, end - begin).minMax();
+}
+
+template <typename T>
+T& BasicArray<T>::at(std::size_t index) {
     if (index >= m_size) {
         throw std::out_of_range("Array index out of range");
     }
+    makeUnique();
     return m_data[index];
 }
 
-const int& Array::at(std::size_t index) const {
+template <typename T>
+const T& BasicArray<T>::at(std::size_t index) const {
     if (index >= m_size) {
         throw std::out_of_range("Array index out of range");
     }
     return m_data[index];
 }
 
-void Array::pushBack(int value) {
+template <typename T>
+void BasicArray<T>::pushBack(T value) {
     ensureCapacity(m_size + 1);
+    makeUnique();
     m_data[m_size] = value;
     ++m_size;
 }
 
-void Array::popBack() {
+template <typename T>
+void BasicArray<T>::popBack() {
     if (m_size > 0) {
         --m_size;
     }
 }
 
-void Array::insert(std::size_t index, int value) {
+template <typename T>
+void BasicArray<T>::insert(std::size_t index, T value) {
     if (index > m_size) {
         throw std::out_of_range("Array index out of range for insert");
     }
     
     ensureCapacity(m_size + 1);
+    makeUnique();
 
     for (std::size_t i = m_size; i > index; --i) {
         m_data[i] = m_data[i - 1];
@@ -137,10 +169,12 @@ void Array::insert(std::size_t index, int value) {
     ++m_size;
 }
 
-void Array::remove(std::size_t index) {
+template <typename T>
+void BasicArray<T>::remove(std::size_t index) {
     if (index >= m_size) {
         throw std::out_of_range("Array index out of range for remove");
     }
+    makeUnique();
 
     for (std::size_t i = index; i < m_size - 1; ++i) {
         m_data[i] = m_data[i + 1];
@@ -149,73 +183,216 @@ void Array::remove(std::size_t index) {
     --m_size;
 }
 
-void Array::swap(std::size_t i, std::size_t j) {
+template <typename T>
+void BasicArray<T>::swap(std::size_t i, std::size_t j) {
     if (i >= m_size || j >= m_size) {
         throw std::out_of_range("Array index out of range for swap");
     }
+    makeUnique();
     
-    int temp = m_data[i];
+    T temp = m_data[i];
     m_data[i] = m_data[j];
     m_data[j] = temp;
 }
 
-void Array::generateRandom(std::size_t count, int min, int max) {
+template <typename T>
+void BasicArray<T>::fill(T value) {
+    if (m_size > 0) {
+        makeUnique();
+        ArrayKernels::fill(m_data, m_size, value);
+    }
+}
+
+template <typename T>
+void BasicArray<T>::assign(BasicArrayView<T> view) {
+    std::size_t count = view.size();
+    if (m_header && m_header->writable && count <= m_capacity
+        && m_header->refCount.load(std::memory_order_acquire) == 1) {
+        if (count > 0 && view.data() != m_data) {
+            std::memmove(m_data, view.data(), count * sizeof(T));
+        }
+        m_size = count;
+        return;
+    }
+    
     if (count == 0) {
-        clear();
+        m_size = 0;
         return;
     }
     
-    ensureCapacity(count);
+    Header* oldHeader = m_header;
+    allocate(count);
+    ArrayKernels::copy(m_data, view.data(), count);
+    if (oldHeader) {
+        release(oldHeader);
+    }
     m_size = count;
+    m_capacity = count;
+}
 
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dis(min, max);
-    
-    for (std::size_t i = 0; i < count; ++i) {
-        m_data[i] = dis(gen);
-    }
+template <typename T>
+void BasicArray<T>::generateRandom(std::size_t count, std::int64_t min, std::int64_t max) {
+    generate(Distribution::Uniform, count, min, max, InputGenerator::randomSeed());
 }
 
-void Array::resize(std::size_t newSize, int value) {
+template <typename T>
+void BasicArray<T>::generate(Distribution distribution, std::size_t count, std::int64_t min, std::int64_t max,
+                             std::uint64_t seed) {
+    InputGenerator(min, max, seed).fill(*this, distribution, count);
+}
+
+template <typename T>
+void BasicArray<T>::resize(std::size_t newSize, T value) {
     if (newSize > m_capacity) {
         ensureCapacity(newSize);
     }
-
-    for (std::size_t i = m_size; i < newSize; ++i) {
-        m_data[i] = value;
+    if (newSize > m_size) {
+        makeUnique();
+        ArrayKernels::fill(m_data + m_size, newSize - m_size, value);
     }
     
     m_size = newSize;
 }
 
-void Array::reserve(std::size_t newCapacity) {
+template <typename T>
+void BasicArray<T>::reserve(std::size_t newCapacity) {
     if (newCapacity > m_capacity) {
         ensureCapacity(newCapacity);
     }
 }
 
-void Array::allocate(std::size_t newCapacity) {
+template <typename T>
+void BasicArray<T>::setResource(std::pmr::memory_resource* resource) {
+    if (resource == m_resource) {
+        return;
+    }
+    
+    m_resource = resource;
+    if (m_header && !m_header->mapping) {
+        reallocate(m_capacity);
+    }
+}
+
+template <typename T>
+void BasicArray<T>::mapFile(const std::string& path, MappedFile::Access access) {
+    std::unique_ptr<MappedFile> mapping = std::make_unique<MappedFile>(path, access);
+    if (mapping->size() % sizeof(T) != 0) {
+        throw std::runtime_error("File size is not a whole number of elements: " + path);
+    }
+    
+    deallocate();
+    m_size = 0;
+    std::size_t count = mapping->size() / sizeof(T);
+    if (count == 0) {
+        return;
+    }
+    
+    bool writable = access == MappedFile::Access::CopyOnWrite;
+    T* data = reinterpret_cast<T*>(writable ? mapping->mutableData() : const_cast<char*>(mapping->data()));
+    m_header = new Header{{1}, mapping.get(), nullptr, 0, writable};
+    mapping.release();
+    m_data = data;
+    m_size = count;
+    m_capacity = count;
+}
+
+template <typename T>
+void BasicArray<T>::share(const BasicArray& other) noexcept {
+    m_data = other.m_data;
+    m_header = other.m_header;
+    m_resource = other.m_resource;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    if (m_header) {
+        m_header->refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+void BasicArray<T>::allocate(std::size_t newCapacity) {
     if (newCapacity == 0) {
         m_data = nullptr;
+        m_header = nullptr;
         return;
     }
 
-    m_data = static_cast<int*>(std::malloc(newCapacity * sizeof(int)));
-    if (!m_data) {
+    std::size_t bytes = storageBytes(newCapacity);
+    char* block = static_cast<char*>(m_resource ? m_resource->allocate(bytes, HEADER_ALIGNMENT) : std::malloc(bytes));
+    if (!block) {
         throw std::bad_alloc();
     }
+    
+    m_header = new (block) Header{{1}, nullptr, m_resource, bytes, true};
+    m_data = reinterpret_cast<T*>(block + HEADER_BYTES);
 }
 
-void Array::deallocate() {
-    if (m_data) {
-        std::free(m_data);
-        m_data = nullptr;
+template <typename T>
+void BasicArray<T>::reallocate(std::size_t newCapacity) {
+    if (newCapacity > m_capacity && resizeInPlace(newCapacity)) {
+        m_capacity = newCapacity;
+        return;
+    }
+    
+    T* oldData = m_data;
+    Header* oldHeader = m_header;
+    
+    allocate(newCapacity);
+    if (oldHeader) {
+        ArrayKernels::copy(m_data, oldData, m_size);
+        release(oldHeader);
+    }
+    m_capacity = newCapacity;
+}
+
+template <typename T>
+bool BasicArray<T>::resizeInPlace(std::size_t newCapacity) {
+    if (!m_header || !m_resource || m_header->mapping || m_header->resource != m_resource
+        || m_header->refCount.load(std::memory_order_acquire) != 1) {
+        return false;
+    }
+    
+    std::size_t bytes = storageBytes(newCapacity);
+    ResizableResource* resizable = dynamic_cast<ResizableResource*>(m_resource);
+    if (!resizable || !resizable->resize(m_header, m_header->blockBytes, bytes, HEADER_ALIGNMENT)) {
+        return false;
+    }
+    m_header->blockBytes = bytes;
+    return true;
+}
+
+template <typename T>
+void BasicArray<T>::deallocate() {
+    if (m_header) {
+        release(m_header);
+        m_header = nullptr;
     }
+    m_data = nullptr;
     m_capacity = 0;
 }
 
-void Array::ensureCapacity(std::size_t minCapacity) {
+template <typename T>
+void BasicArray<T>::release(Header* header) noexcept {
+    if (header->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    
+    if (header->mapping) {
+        delete header->mapping;
+        delete header;
+    } else {
+        std::pmr::memory_resource* resource = header->resource;
+        std::size_t bytes = header->blockBytes;
+        header->~Header();
+        if (resource) {
+            resource->deallocate(header, bytes, HEADER_ALIGNMENT);
+        } else {
+            std::free(header);
+        }
+    }
+}
+
+template <typename T>
+void BasicArray<T>::ensureCapacity(std::size_t minCapacity) {
     if (minCapacity <= m_capacity) {
         return;
     }
@@ -225,20 +402,13 @@ void Array::ensureCapacity(std::size_t minCapacity) {
         newCapacity *= GROWTH_FACTOR;
     }
 
-    int* newData = static_cast<int*>(std::malloc(newCapacity * sizeof(int)));
-    if (!newData) {
-        throw std::bad_alloc();
-    }
-
-    if (m_data) {
-        for (std::size_t i = 0; i < m_size; ++i) {
-            newData[i] = m_data[i];
-        }
-        std::free(m_data);
-    }
-    
-    m_data = newData;
-    m_capacity = newCapacity;
+    reallocate(newCapacity);
 }
 
+template class BasicArray<int>;
+template class BasicArray<std::int64_t>;
+template class BasicArray<float>;
+template class BasicArray<double>;
+template class BasicArray<KeyedRecord>;
+
 } 
@@ -2,47 +2,77 @@
 
 #pragma once
 
+#include "ArrayView.h"
+#include "Distribution.h"
+#include "ElementTraits.h"
+#include "../../Core/IO/MappedFile.h"
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <memory_resource>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 namespace DSA {
 
 
-class Array {
+template <typename T>
+class BasicArray {
+    static_assert(std::is_trivially_copyable<T>::value, "BasicArray elements must be trivially copyable");
+
 public:
+    using value_type = T;
+    
+    
+    BasicArray();
+    
+    
+    explicit BasicArray(std::size_t size, T value = T(), std::pmr::memory_resource* resource = nullptr);
+    
+    
+    explicit BasicArray(BasicArrayView<T> view, std::pmr::memory_resource* resource = nullptr);
     
-    Array();
     
+    BasicArray(const BasicArray& other);
     
-    explicit Array(std::size_t size, int value = 0);
     
+    BasicArray(BasicArray&& other) noexcept;
     
-    Array(const Array& other);
     
+    ~BasicArray();
     
-    Array(Array&& other) noexcept;
     
+    BasicArray& operator=(const BasicArray& other);
     
-    ~Array();
     
+    BasicArray& operator=(BasicArray&& other) noexcept;
     
-    Array& operator=(const Array& other);
     
+    T& at(std::size_t index);
     
-    Array& operator=(Array&& other) noexcept;
     
+    const T& at(std::size_t index) const;
     
-    int& at(std::size_t index);
     
+    T& operator[](std::size_t index) {
+        makeUnique();
+        return m_data[index];
+    }
     
-    const int& at(std::size_t index) const;
     
+    const T& operator[](std::size_t index) const { return m_data[index]; }
     
-    int& operator[](std::size_t index) { return m_data[index]; }
     
+    T* data() {
+        makeUnique();
+        return m_data;
+    }
     
-    const int& operator[](std::size_t index) const { return m_data[index]; }
+    
+    const T* data() const noexcept { return m_data; }
     
     
     std::size_t size() const noexcept { return m_size; }
@@ -54,13 +84,54 @@ public:
     bool isEmpty() const noexcept { return m_size == 0; }
     
     
-    void pushBack(int value);
+    std::pmr::memory_resource* resource() const noexcept { return m_resource; }
+    
+    
+    void setResource(std::pmr::memory_resource* resource);
+    
+    
+    bool isShared() const noexcept {
+        return m_header && m_header->refCount.load(std::memory_order_acquire) > 1;
+    }
+    
+    
+    bool isMapped() const noexcept { return m_header && m_header->mapping; }
+    
+    
+    bool sharesStorageWith(const BasicArray& other) const noexcept { return m_data && m_data == other.m_data; }
+    
+    
+    BasicArrayView<T> view() const noexcept { return BasicArrayView<T>(m_data, m_size); }
+    
+    
+    bool operator==(const BasicArray& other) const { return view() == other.view(); }
+    
+    
+    bool operator!=(const BasicArray& other) const { return view() != other.view(); }
+    
+    
+    std::pair<T, T> minMax() const { return view().minMax(); }
+    
+    
+    std::pair<T, T> minMax(std::size_t begin, std::size_t end) const;
+    
+    
+    bool isSorted() const { return view().isSorted(); }
+    
+    
+    std::size_t sortedPrefix() const { return view().sortedPrefix(); }
+    
+    
+    std::size_t countRuns() const { return view().countRuns(); }
+    
+    
+    void pushBack(T value);
     
     
     void popBack();
     
     
-    void insert(std::size_t index, int value);
+    void insert(std::size_t index, T value);
     
     
     void remove(std::size_t index);
@@ -72,27 +143,86 @@ public:
     void clear() noexcept { m_size = 0; }
     
     
-    void generateRandom(std::size_t count, int min, int max);
+    void fill(T value);
     
     
-    void resize(std::size_t newSize, int value = 0);
+    void assign(BasicArrayView<T> view);
+    
+    
+    void generateRandom(std::size_t count, std::int64_t min, std::int64_t max);
+    
+    
+    void generate(Distribution distribution, std::size_t count, std::int64_t min, std::int64_t max,
+                  std::uint64_t seed);
+    
+    
+    void resize(std::size_t newSize, T value = T());
     
     
     void reserve(std::size_t newCapacity);
+    
+    
+    void mapFile(const std::string& path, MappedFile::Access access);
 
 private:
-    int* m_data;
+    struct Header {
+        std::atomic<std::size_t> refCount;
+        MappedFile* mapping;
+        std::pmr::memory_resource* resource;
+        std::size_t blockBytes;
+        bool writable;
+    };
+    
+    static constexpr std::size_t HEADER_ALIGNMENT = alignof(T) > alignof(Header) ? alignof(T) : alignof(Header);
+    static constexpr std::size_t HEADER_BYTES = (sizeof(Header) + HEADER_ALIGNMENT - 1) / HEADER_ALIGNMENT * HEADER_ALIGNMENT;
+    
+    static constexpr std::size_t storageBytes(std::size_t capacity) noexcept { return HEADER_BYTES + capacity * sizeof(T); }
+    
+    T* m_data;
+    Header* m_header;
+    std::pmr::memory_resource* m_resource;
     std::size_t m_size;
     std::size_t m_capacity;
     
     
+    void makeUnique() {
+        if (m_header && (!m_header->writable || m_header->refCount.load(std::memory_order_acquire) > 1)) {
+            reallocate(m_capacity);
+        }
+    }
+    
+    
+    void share(const BasicArray& other) noexcept;
+    
+    
     void allocate(std::size_t newCapacity);
     
     
+    void reallocate(std::size_t newCapacity);
+    
+    
+    bool resizeInPlace(std::size_t newCapacity);
+    
+    
     void deallocate();
     
     
+    static void release(Header* header) noexcept;
+    
+    
     void ensureCapacity(std::size_t minCapacity);
 };
 
+using Array = BasicArray<int>;
+using Int64Array = BasicArray<std::int64_t>;
+using FloatArray = BasicArray<float>;
+using DoubleArray = BasicArray<double>;
+using RecordArray = BasicArray<KeyedRecord>;
+
+extern template class BasicArray<int>;
+extern template class BasicArray<std::int64_t>;
+extern template class BasicArray<float>;
+extern template class BasicArray<double>;
+extern template class BasicArray<KeyedRecord>;
+
 } 
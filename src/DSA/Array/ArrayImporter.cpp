@@ -0,0 +1,205 @@
+#include "ArrayImporter.h"
+#include "ParallelFor.h"
+#include "../../App/Config.h"
+#include "../../Core/IO/MappedFile.h"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace DSA {
+
+static constexpr std::size_t NO_ERROR = static_cast<std::size_t>(-1);
+
+Array ArrayImporter::load(const std::string& path, Format format) {
+    if (format == Format::Auto) {
+        format = detectFormat(path);
+    }
+    
+    Array array;
+    if (format == Format::Binary) {
+        array.mapFile(path, MappedFile::Access::CopyOnWrite);
+        return array;
+    }
+    
+    MappedFile file(path);
+    try {
+        return parseText(file.data(), file.size());
+    } catch (const std::runtime_error& e) {
+        throw std::runtime_error(path + ": " + e.what());
+    }
+}
+
+ArrayImporter::Format ArrayImporter::detectFormat(const std::string& path) {
+    std::size_t dot = path.find_last_of('.');
+    std::string extension = dot == std::string::npos ? "" : path.substr(dot);
+    for (char& c : extension) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    
+    if (extension == ".csv") {
+        return Format::Csv;
+    }
+    if (extension == ".bin" || extension == ".raw") {
+        return Format::Binary;
+    }
+    return Format::Text;
+}
+
+Array ArrayImporter::parseText(const char* data, std::size_t size) {
+    Array array;
+    if (size == 0) {
+        return array;
+    }
+    
+    const char* end = data + size;
+    const char* firstLineEnd = findLineEnd(data, end);
+    std::size_t start = 0;
+    if (!isBlank(data, firstLineEnd)) {
+        std::vector<int> header(countFields(data, firstLineEnd));
+        if (!parseLine(data, firstLineEnd, header.data())) {
+            start = static_cast<std::size_t>(firstLineEnd - data);
+        }
+    }
+    
+    std::size_t workers = parallelWorkers(size - start, Config::IMPORT_PARALLEL_GRAIN_BYTES);
+    std::vector<Chunk> chunks(workers);
+    std::size_t position = start;
+    for (std::size_t i = 0; i < workers; ++i) {
+        std::size_t target = start + (size - start) * (i + 1) / workers;
+        if (target < position) {
+            target = position;
+        }
+        const char* boundary = i + 1 == workers ? end : findLineEnd(data + target, end);
+        chunks[i] = Chunk{position, static_cast<std::size_t>(boundary - data), 0, 0, NO_ERROR};
+        position = chunks[i].end;
+    }
+    
+    parallelChunks(workers, [&chunks, data](std::size_t worker) {
+        Chunk& chunk = chunks[worker];
+        const char* line = data + chunk.begin;
+        const char* limit = data + chunk.end;
+        while (line < limit) {
+            const char* lineEnd = findLineEnd(line, limit);
+            if (!isBlank(line, lineEnd)) {
+                chunk.count += countFields(line, lineEnd);
+            }
+            line = lineEnd;
+        }
+    });
+    
+    std::size_t total = 0;
+    for (Chunk& chunk : chunks) {
+        chunk.offset = total;
+        total += chunk.count;
+    }
+    
+    array.resize(total);
+    int* values = array.data();
+    parallelChunks(workers, [&chunks, data, values](std::size_t worker) {
+        Chunk& chunk = chunks[worker];
+        const char* line = data + chunk.begin;
+        const char* limit = data + chunk.end;
+        int* out = values + chunk.offset;
+        while (line < limit) {
+            const char* lineEnd = findLineEnd(line, limit);
+            if (!isBlank(line, lineEnd)) {
+                if (!parseLine(line, lineEnd, out)) {
+                    chunk.errorPosition = static_cast<std::size_t>(line - data);
+                    return;
+                }
+                out += countFields(line, lineEnd);
+            }
+            line = lineEnd;
+        }
+    });
+    
+    for (const Chunk& chunk : chunks) {
+        if (chunk.errorPosition != NO_ERROR) {
+            throw std::runtime_error("Invalid integer at byte " + std::to_string(chunk.errorPosition));
+        }
+    }
+    return array;
+}
+
+const char* ArrayImporter::findLineEnd(const char* line, const char* end) {
+    const void* newline = std::memchr(line, '\n', static_cast<std::size_t>(end - line));
+    return newline ? static_cast<const char*>(newline) + 1 : end;
+}
+
+std::size_t ArrayImporter::countFields(const char* line, const char* end) {
+    std::size_t fields = 1;
+    for (; line < end; ++line) {
+        if (isDelimiter(*line)) {
+            ++fields;
+        }
+    }
+    return fields;
+}
+
+bool ArrayImporter::parseLine(const char* line, const char* end, int* out) {
+    while (parseField(line, end, *out)) {
+        ++out;
+        if (line == end || *line == '\n') {
+            return true;
+        }
+        if (!isDelimiter(*line)) {
+            return false;
+        }
+        ++line;
+    }
+    return false;
+}
+
+bool ArrayImporter::parseField(const char*& field, const char* end, int& value) {
+    const char* line = field;
+    while (line < end && (*line == ' ' || *line == '\t')) {
+        ++line;
+    }
+    
+    bool negative = false;
+    if (line < end && (*line == '-' || *line == '+')) {
+        negative = *line == '-';
+        ++line;
+    }
+    
+    const char* digits = line;
+    long long magnitude = 0;
+    long long limit = negative ? -static_cast<long long>(std::numeric_limits<int>::min())
+                               : std::numeric_limits<int>::max();
+    while (line < end && *line >= '0' && *line <= '9') {
+        magnitude = magnitude * 10 + (*line - '0');
+        if (magnitude > limit) {
+            return false;
+        }
+        ++line;
+    }
+    if (line == digits) {
+        return false;
+    }
+    
+    while (line < end && (*line == ' ' || *line == '\t' || *line == '\r')) {
+        ++line;
+    }
+    
+    value = static_cast<int>(negative ? -magnitude : magnitude);
+    field = line;
+    return true;
+}
+
+bool ArrayImporter::isDelimiter(char c) {
+    return c == ',' || c == ';';
+}
+
+bool ArrayImporter::isBlank(const char* line, const char* end) {
+    for (; line < end; ++line) {
+        if (*line != ' ' && *line != '\t' && *line != '\r' && *line != '\n') {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
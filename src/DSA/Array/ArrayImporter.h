@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Array.h"
+#include <cstddef>
+#include <string>
+
+namespace DSA {
+
+class ArrayImporter {
+public:
+    enum class Format {
+        Auto,
+        Csv,
+        Text,
+        Binary
+    };
+    
+    static Array load(const std::string& path, Format format = Format::Auto);
+    static Format detectFormat(const std::string& path);
+    static Array parseText(const char* data, std::size_t size);
+
+private:
+    struct Chunk {
+        std::size_t begin;
+        std::size_t end;
+        std::size_t count;
+        std::size_t offset;
+        std::size_t errorPosition;
+    };
+    
+    static const char* findLineEnd(const char* line, const char* end);
+    static std::size_t countFields(const char* line, const char* end);
+    static bool parseLine(const char* line, const char* end, int* out);
+    static bool parseField(const char*& field, const char* end, int& value);
+    static bool isDelimiter(char c);
+    static bool isBlank(const char* line, const char* end);
+};
+
+}
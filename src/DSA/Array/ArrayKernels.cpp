@@ -0,0 +1,368 @@
+#include "ArrayKernels.h"
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define DSA_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DSA_TARGET_SSE2
+#define DSA_TARGET_AVX2
+#else
+#define DSA_TARGET_SSE2 __attribute__((target("sse2")))
+#define DSA_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace DSA {
+
+namespace {
+
+struct KernelTable {
+    SimdLevel level;
+    void (*minMax)(const int*, std::size_t, int&, int&);
+    void (*fill)(int*, std::size_t, int);
+    bool (*equal)(const int*, const int*, std::size_t);
+    std::size_t (*sortedPrefix)(const int*, std::size_t);
+    std::size_t (*countDescents)(const int*, std::size_t);
+};
+
+void minMaxScalar(const int* data, std::size_t count, int& minValue, int& maxValue) {
+    ArrayKernels::minMax<int>(data, count, minValue, maxValue);
+}
+
+void fillScalar(int* data, std::size_t count, int value) {
+    ArrayKernels::fill<int>(data, count, value);
+}
+
+bool equalScalar(const int* a, const int* b, std::size_t count) {
+    return count == 0 || std::memcmp(a, b, count * sizeof(int)) == 0;
+}
+
+std::size_t sortedPrefixScalar(const int* data, std::size_t count) {
+    return ArrayKernels::sortedPrefix<int>(data, count);
+}
+
+std::size_t countDescentsScalar(const int* data, std::size_t count) {
+    return ArrayKernels::countDescents<int>(data, count);
+}
+
+const KernelTable SCALAR_TABLE = {
+    SimdLevel::Scalar, minMaxScalar, fillScalar, equalScalar, sortedPrefixScalar, countDescentsScalar
+};
+
+unsigned lowestBit(unsigned mask) {
+    unsigned index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+}
+
+#ifdef DSA_KERNELS_X86
+
+DSA_TARGET_SSE2 __m128i select128(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+DSA_TARGET_SSE2 void minMaxSse2(const int* data, std::size_t count, int& minValue, int& maxValue) {
+    std::size_t i = 0;
+    if (count >= 4) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        __m128i high = low;
+        for (i = 4; i + 4 <= count; i += 4) {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            low = select128(_mm_cmplt_epi32(values, low), values, low);
+            high = select128(_mm_cmpgt_epi32(values, high), values, high);
+        }
+        alignas(16) int lows[4];
+        alignas(16) int highs[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lows), low);
+        _mm_store_si128(reinterpret_cast<__m128i*>(highs), high);
+        int ignored;
+        ArrayKernels::minMax<int>(lows, 4, minValue, ignored);
+        ArrayKernels::minMax<int>(highs, 4, ignored, maxValue);
+    } else {
+        minValue = data[0];
+        maxValue = data[0];
+    }
+    for (; i < count; ++i) {
+        if (data[i] < minValue) {
+            minValue = data[i];
+        }
+        if (data[i] > maxValue) {
+            maxValue = data[i];
+        }
+    }
+}
+
+DSA_TARGET_SSE2 void fillSse2(int* data, std::size_t count, int value) {
+    __m128i values = _mm_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), values);
+    }
+    for (; i < count; ++i) {
+        data[i] = value;
+    }
+}
+
+DSA_TARGET_SSE2 bool equalSse2(const int* a, const int* b, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(left, right)) != 0xFFFF) {
+            return false;
+        }
+    }
+    for (; i < count; ++i) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+DSA_TARGET_SSE2 std::size_t sortedPrefixSse2(const int* data, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 5 <= count; i += 4) {
+        __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(current, next)));
+        if (mask) {
+            return i + lowestBit(static_cast<unsigned>(mask)) + 1;
+        }
+    }
+    return i + ArrayKernels::sortedPrefix<int>(data + i, count - i);
+}
+
+DSA_TARGET_SSE2 std::size_t countDescentsSse2(const int* data, std::size_t count) {
+    std::size_t i = 0;
+    std::size_t descents = 0;
+    while (i + 5 <= count) {
+        std::size_t blockEnd = i + std::size_t(4) * INT32_MAX;
+        __m128i lanes = _mm_setzero_si128();
+        for (; i + 5 <= count && i < blockEnd; i += 4) {
+            __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+            lanes = _mm_sub_epi32(lanes, _mm_cmpgt_epi32(current, next));
+        }
+        alignas(16) std::uint32_t counts[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(counts), lanes);
+        descents += std::size_t(counts[0]) + counts[1] + counts[2] + counts[3];
+    }
+    return descents + ArrayKernels::countDescents<int>(data + i, count - i);
+}
+
+const KernelTable SSE2_TABLE = {
+    SimdLevel::Sse2, minMaxSse2, fillSse2, equalSse2, sortedPrefixSse2, countDescentsSse2
+};
+
+DSA_TARGET_AVX2 void minMaxAvx2(const int* data, std::size_t count, int& minValue, int& maxValue) {
+    if (count < 8) {
+        minMaxSse2(data, count, minValue, maxValue);
+        return;
+    }
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i high = low;
+    std::size_t i = 8;
+    for (; i + 8 <= count; i += 8) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        low = _mm256_min_epi32(low, values);
+        high = _mm256_max_epi32(high, values);
+    }
+    alignas(32) int lows[8];
+    alignas(32) int highs[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lows), low);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(highs), high);
+    int ignored;
+    ArrayKernels::minMax<int>(lows, 8, minValue, ignored);
+    ArrayKernels::minMax<int>(highs, 8, ignored, maxValue);
+    for (; i < count; ++i) {
+        if (data[i] < minValue) {
+            minValue = data[i];
+        }
+        if (data[i] > maxValue) {
+            maxValue = data[i];
+        }
+    }
+}
+
+DSA_TARGET_AVX2 void fillAvx2(int* data, std::size_t count, int value) {
+    __m256i values = _mm256_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), values);
+    }
+    for (; i < count; ++i) {
+        data[i] = value;
+    }
+}
+
+DSA_TARGET_AVX2 bool equalAvx2(const int* a, const int* b, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(left, right)) != -1) {
+            return false;
+        }
+    }
+    return equalSse2(a + i, b + i, count - i);
+}
+
+DSA_TARGET_AVX2 std::size_t sortedPrefixAvx2(const int* data, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 9 <= count; i += 8) {
+        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 1));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(current, next)));
+        if (mask) {
+            return i + lowestBit(static_cast<unsigned>(mask)) + 1;
+        }
+    }
+    return i + sortedPrefixSse2(data + i, count - i);
+}
+
+DSA_TARGET_AVX2 std::size_t countDescentsAvx2(const int* data, std::size_t count) {
+    std::size_t i = 0;
+    std::size_t descents = 0;
+    while (i + 9 <= count) {
+        std::size_t blockEnd = i + std::size_t(8) * INT32_MAX;
+        __m256i lanes = _mm256_setzero_si256();
+        for (; i + 9 <= count && i < blockEnd; i += 8) {
+            __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 1));
+            lanes = _mm256_sub_epi32(lanes, _mm256_cmpgt_epi32(current, next));
+        }
+        alignas(32) std::uint32_t counts[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts), lanes);
+        for (std::uint32_t laneCount : counts) {
+            descents += laneCount;
+        }
+    }
+    return descents + countDescentsSse2(data + i, count - i);
+}
+
+const KernelTable AVX2_TABLE = {
+    SimdLevel::Avx2, minMaxAvx2, fillAvx2, equalAvx2, sortedPrefixAvx2, countDescentsAvx2
+};
+
+bool cpuSupportsAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4];
+    __cpuid(registers, 0);
+    if (registers[0] < 7) {
+        return false;
+    }
+    __cpuid(registers, 1);
+    bool osSavesYmm = (registers[2] & (1 << 27)) && (registers[2] & (1 << 28))
+        && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(registers, 7, 0);
+    return osSavesYmm && (registers[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+bool cpuSupportsSse2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4];
+    __cpuid(registers, 1);
+    return (registers[3] & (1 << 26)) != 0;
+#else
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+#endif
+
+const KernelTable& tableFor(SimdLevel level) {
+#ifdef DSA_KERNELS_X86
+    switch (level) {
+        case SimdLevel::Avx2:
+            return AVX2_TABLE;
+        case SimdLevel::Sse2:
+            return SSE2_TABLE;
+        default:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    return SCALAR_TABLE;
+}
+
+std::atomic<const KernelTable*> s_activeTable{nullptr};
+
+const KernelTable& activeTable() {
+    const KernelTable* table = s_activeTable.load(std::memory_order_acquire);
+    if (!table) {
+        table = &tableFor(ArrayKernels::detectLevel());
+        s_activeTable.store(table, std::memory_order_release);
+    }
+    return *table;
+}
+
+}
+
+SimdLevel ArrayKernels::detectLevel() noexcept {
+#ifdef DSA_KERNELS_X86
+    static const SimdLevel detected = cpuSupportsAvx2() ? SimdLevel::Avx2
+        : cpuSupportsSse2() ? SimdLevel::Sse2 : SimdLevel::Scalar;
+    return detected;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+SimdLevel ArrayKernels::getLevel() noexcept {
+    return activeTable().level;
+}
+
+void ArrayKernels::setLevel(SimdLevel level) noexcept {
+    if (level > detectLevel()) {
+        level = detectLevel();
+    }
+    s_activeTable.store(&tableFor(level), std::memory_order_release);
+}
+
+const char* ArrayKernels::getLevelName(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::Avx2:
+            return "AVX2";
+        case SimdLevel::Sse2:
+            return "SSE2";
+        default:
+            return "Scalar";
+    }
+}
+
+void ArrayKernels::minMax(const int* data, std::size_t count, int& minValue, int& maxValue) noexcept {
+    activeTable().minMax(data, count, minValue, maxValue);
+}
+
+void ArrayKernels::fill(int* data, std::size_t count, int value) noexcept {
+    activeTable().fill(data, count, value);
+}
+
+void ArrayKernels::copy(int* destination, const int* source, std::size_t count) noexcept {
+    copy<int>(destination, source, count);
+}
+
+bool ArrayKernels::equal(const int* a, const int* b, std::size_t count) noexcept {
+    return activeTable().equal(a, b, count);
+}
+
+std::size_t ArrayKernels::sortedPrefix(const int* data, std::size_t count) noexcept {
+    return activeTable().sortedPrefix(data, count);
+}
+
+std::size_t ArrayKernels::countDescents(const int* data, std::size_t count) noexcept {
+    return activeTable().countDescents(data, count);
+}
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+namespace DSA {
+
+enum class SimdLevel {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+class ArrayKernels {
+public:
+    static SimdLevel detectLevel() noexcept;
+    static SimdLevel getLevel() noexcept;
+    static void setLevel(SimdLevel level) noexcept;
+    static const char* getLevelName(SimdLevel level) noexcept;
+
+    static void minMax(const int* data, std::size_t count, int& minValue, int& maxValue) noexcept;
+    static void fill(int* data, std::size_t count, int value) noexcept;
+    static void copy(int* destination, const int* source, std::size_t count) noexcept;
+    static bool equal(const int* a, const int* b, std::size_t count) noexcept;
+    static std::size_t sortedPrefix(const int* data, std::size_t count) noexcept;
+    static std::size_t countDescents(const int* data, std::size_t count) noexcept;
+
+    template <typename T>
+    static void minMax(const T* data, std::size_t count, T& minValue, T& maxValue) {
+        minValue = data[0];
+        maxValue = data[0];
+        for (std::size_t i = 1; i < count; ++i) {
+            if (data[i] < minValue) {
+                minValue = data[i];
+            }
+            if (data[i] > maxValue) {
+                maxValue = data[i];
+            }
+        }
+    }
+
+    template <typename T>
+    static void fill(T* data, std::size_t count, const T& value) {
+        for (std::size_t i = 0; i < count; ++i) {
+            data[i] = value;
+        }
+    }
+
+    template <typename T>
+    static void copy(T* destination, const T* source, std::size_t count) noexcept {
+        if (count > 0) {
+            std::memcpy(destination, source, count * sizeof(T));
+        }
+    }
+
+    template <typename T>
+    static bool equal(const T* a, const T* b, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (a[i] != b[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    static std::size_t sortedPrefix(const T* data, std::size_t count) {
+        for (std::size_t i = 1; i < count; ++i) {
+            if (data[i - 1] > data[i]) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <typename T>
+    static std::size_t countDescents(const T* data, std::size_t count) {
+        std::size_t descents = 0;
+        for (std::size_t i = 1; i < count; ++i) {
+            if (data[i - 1] > data[i]) {
+                ++descents;
+            }
+        }
+        return descents;
+    }
+};
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ArrayKernels.h"
+#include "ElementTraits.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace DSA {
+
+template <typename T>
+class BasicArray;
+
+template <typename T>
+class BasicArrayView {
+public:
+    using value_type = T;
+
+    BasicArrayView() noexcept
+        : m_data(nullptr)
+        , m_size(0)
+    {
+    }
+
+    BasicArrayView(const T* data, std::size_t size) noexcept
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    BasicArrayView(const BasicArray<T>& array) noexcept
+        : m_data(array.data())
+        , m_size(array.size())
+    {
+    }
+
+    const T* data() const noexcept { return m_data; }
+    std::size_t size() const noexcept { return m_size; }
+    bool isEmpty() const noexcept { return m_size == 0; }
+
+    const T* begin() const noexcept { return m_data; }
+    const T* end() const noexcept { return m_data + m_size; }
+
+    const T& operator[](std::size_t index) const { return m_data[index]; }
+
+    const T& at(std::size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("ArrayView index out of range");
+        }
+        return m_data[index];
+    }
+
+    BasicArrayView subview(std::size_t offset, std::size_t count) const {
+        if (offset > m_size || count > m_size - offset) {
+            throw std::out_of_range("ArrayView subview out of range");
+        }
+        return BasicArrayView(m_data + offset, count);
+    }
+
+    std::pair<T, T> minMax() const {
+        if (m_size == 0) {
+            throw std::out_of_range("ArrayView minMax of an empty range");
+        }
+        std::pair<T, T> result;
+        ArrayKernels::minMax(m_data, m_size, result.first, result.second);
+        return result;
+    }
+
+    std::size_t sortedPrefix() const { return m_size == 0 ? 0 : ArrayKernels::sortedPrefix(m_data, m_size); }
+    bool isSorted() const { return sortedPrefix() == m_size; }
+    std::size_t countRuns() const { return m_size == 0 ? 0 : ArrayKernels::countDescents(m_data, m_size) + 1; }
+
+    bool operator==(const BasicArrayView& other) const {
+        return m_size == other.m_size && (m_data == other.m_data || ArrayKernels::equal(m_data, other.m_data, m_size));
+    }
+    bool operator!=(const BasicArrayView& other) const { return !(*this == other); }
+
+private:
+    const T* m_data;
+    std::size_t m_size;
+};
+
+using ArrayView = BasicArrayView<int>;
+using Int64ArrayView = BasicArrayView<std::int64_t>;
+using FloatArrayView = BasicArrayView<float>;
+using DoubleArrayView = BasicArrayView<double>;
+using RecordArrayView = BasicArrayView<KeyedRecord>;
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DSA {
+
+class CounterRng {
+public:
+    explicit CounterRng(std::uint64_t seed) noexcept
+        : m_key(mix(seed))
+    {
+    }
+    
+    std::uint64_t at(std::uint64_t counter) const noexcept {
+        return mix(m_key + counter * GOLDEN_GAMMA);
+    }
+    
+    std::int64_t uniform(std::uint64_t counter, std::int64_t min, std::int64_t max) const noexcept {
+        std::uint64_t span = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1;
+        std::uint64_t bits = at(counter);
+        std::uint64_t offset = span == 0 ? bits : bits % span;
+        return static_cast<std::int64_t>(static_cast<std::uint64_t>(min) + offset);
+    }
+    
+    double unit(std::uint64_t counter) const noexcept {
+        return static_cast<double>(at(counter) >> 11) * 0x1.0p-53;
+    }
+
+private:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+    
+    std::uint64_t m_key;
+    
+    static std::uint64_t mix(std::uint64_t value) noexcept {
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+};
+
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace DSA {
+
+enum class Distribution {
+    Uniform,
+    Sorted,
+    Reversed,
+    NearlySorted,
+    FewUnique,
+    Sawtooth,
+    OrganPipe,
+    Zipfian,
+    Count
+};
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace DSA {
+
+struct KeyedRecord {
+    std::int64_t key;
+    std::uint64_t payload[7];
+};
+
+inline bool operator<(const KeyedRecord& a, const KeyedRecord& b) { return a.key < b.key; }
+inline bool operator>(const KeyedRecord& a, const KeyedRecord& b) { return a.key > b.key; }
+inline bool operator==(const KeyedRecord& a, const KeyedRecord& b) {
+    if (a.key != b.key) {
+        return false;
+    }
+    for (std::size_t i = 0; i < 7; ++i) {
+        if (a.payload[i] != b.payload[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+inline bool operator!=(const KeyedRecord& a, const KeyedRecord& b) { return !(a == b); }
+
+template <typename T>
+struct ElementTraits {
+    static double key(const T& value) { return static_cast<double>(value); }
+    static std::int64_t display(const T& value) { return static_cast<std::int64_t>(value); }
+    static T fromKey(std::int64_t key) { return static_cast<T>(key); }
+    static std::string toString(const T& value) { return std::to_string(value); }
+};
+
+template <>
+struct ElementTraits<KeyedRecord> {
+    static double key(const KeyedRecord& value) { return static_cast<double>(value.key); }
+    static std::int64_t display(const KeyedRecord& value) { return value.key; }
+    
+    static KeyedRecord fromKey(std::int64_t key) {
+        KeyedRecord record = {};
+        record.key = key;
+        for (std::uint64_t& word : record.payload) {
+            word = static_cast<std::uint64_t>(key);
+        }
+        return record;
+    }
+    
+    static std::string toString(const KeyedRecord& value) { return std::to_string(value.key); }
+};
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+
+namespace DSA {
+
+enum class ElementType {
+    Int32,
+    Int64,
+    Float,
+    Double,
+    Record,
+    Count
+};
+
+inline std::string getElementTypeName(ElementType type) {
+    switch (type) {
+        case ElementType::Int32:
+            return "int32";
+        case ElementType::Int64:
+            return "int64";
+        case ElementType::Float:
+            return "float";
+        case ElementType::Double:
+            return "double";
+        case ElementType::Record:
+            return "record";
+        default:
+            return "unknown";
+    }
+}
+
+inline ElementType nextElementType(ElementType type) {
+    int following = static_cast<int>(type) + 1;
+    if (following >= static_cast<int>(ElementType::Count)) {
+        following = 0;
+    }
+    return static_cast<ElementType>(following);
+}
+
+}
@@ -0,0 +1,184 @@
+#include "InputGenerator.h"
+#include "ParallelFor.h"
+#include "../../App/Config.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace DSA {
+
+InputGenerator::InputGenerator(std::int64_t min, std::int64_t max, std::uint64_t seed)
+    : m_min(min)
+    , m_max(max)
+    , m_rng(seed)
+    , m_swapRng(~seed)
+    , m_zipfCdf()
+    , m_zipfGuide()
+{
+    if (min > max) {
+        throw std::invalid_argument("Generator range minimum exceeds maximum");
+    }
+    
+    std::uint64_t span = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1;
+    std::uint64_t ranks = span == 0 || span > Config::GENERATOR_ZIPF_RANKS ? Config::GENERATOR_ZIPF_RANKS : span;
+    
+    m_zipfCdf.resize(static_cast<std::size_t>(ranks));
+    double total = 0.0;
+    for (std::size_t rank = 0; rank < m_zipfCdf.size(); ++rank) {
+        total += 1.0 / std::pow(static_cast<double>(rank + 1), Config::GENERATOR_ZIPF_EXPONENT);
+        m_zipfCdf[rank] = total;
+    }
+    for (double& probability : m_zipfCdf) {
+        probability /= total;
+    }
+    
+    m_zipfGuide.resize(m_zipfCdf.size());
+    std::size_t rank = 0;
+    for (std::size_t bucket = 0; bucket < m_zipfGuide.size(); ++bucket) {
+        double threshold = static_cast<double>(bucket) / static_cast<double>(m_zipfGuide.size());
+        while (rank + 1 < m_zipfCdf.size() && m_zipfCdf[rank] < threshold) {
+            ++rank;
+        }
+        m_zipfGuide[bucket] = static_cast<std::uint32_t>(rank);
+    }
+}
+
+template <typename T>
+void InputGenerator::fill(BasicArray<T>& array, Distribution distribution, std::size_t count) const {
+    array.resize(count);
+    if (count == 0) {
+        return;
+    }
+    
+    T* values = array.data();
+    parallelFor(count, Config::GENERATOR_PARALLEL_GRAIN, [this, values, distribution, count](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            values[i] = ElementTraits<T>::fromKey(keyAt(distribution, i, count));
+        }
+    });
+    
+    if (distribution == Distribution::NearlySorted) {
+        scatterSwaps(values, count);
+    }
+}
+
+std::string InputGenerator::getName(Distribution distribution) {
+    switch (distribution) {
+        case Distribution::Uniform:
+            return "Uniform";
+        case Distribution::Sorted:
+            return "Sorted";
+        case Distribution::Reversed:
+            return "Reversed";
+        case Distribution::NearlySorted:
+            return "Nearly Sorted";
+        case Distribution::FewUnique:
+            return "Few Unique";
+        case Distribution::Sawtooth:
+            return "Sawtooth";
+        case Distribution::OrganPipe:
+            return "Organ Pipe";
+        case Distribution::Zipfian:
+            return "Zipfian";
+        default:
+            return "Unknown";
+    }
+}
+
+Distribution InputGenerator::next(Distribution distribution) {
+    int following = static_cast<int>(distribution) + 1;
+    if (following >= static_cast<int>(Distribution::Count)) {
+        following = 0;
+    }
+    return static_cast<Distribution>(following);
+}
+
+std::uint64_t InputGenerator::randomSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+}
+
+std::int64_t InputGenerator::keyAt(Distribution distribution, std::size_t index, std::size_t count) const {
+    switch (distribution) {
+        case Distribution::Uniform:
+            return m_rng.uniform(index, m_min, m_max);
+            
+        case Distribution::Sorted:
+        case Distribution::NearlySorted:
+            return level(index, count);
+            
+        case Distribution::Reversed:
+            return level(count - 1 - index, count);
+            
+        case Distribution::FewUnique:
+            return level(m_rng.at(index) % Config::GENERATOR_FEW_UNIQUE_VALUES, Config::GENERATOR_FEW_UNIQUE_VALUES);
+            
+        case Distribution::Sawtooth: {
+            std::size_t period = (count + Config::GENERATOR_SAWTOOTH_TEETH - 1) / Config::GENERATOR_SAWTOOTH_TEETH;
+            if (period < 2) {
+                period = 2;
+            }
+            return level(index % period, period);
+        }
+            
+        case Distribution::OrganPipe: {
+            std::size_t half = (count + 1) / 2;
+            std::size_t position = index < half ? index : count - 1 - index;
+            return level(position, half);
+        }
+            
+        case Distribution::Zipfian:
+            return level(sampleZipf(index), m_zipfCdf.size());
+            
+        default:
+            return m_min;
+    }
+}
+
+std::int64_t InputGenerator::level(std::uint64_t step, std::uint64_t levels) const {
+    if (levels <= 1) {
+        return m_min;
+    }
+    
+    double range = static_cast<double>(m_max) - static_cast<double>(m_min);
+    double offset = std::floor(range * static_cast<double>(step) / static_cast<double>(levels - 1));
+    return m_min + static_cast<std::int64_t>(offset);
+}
+
+std::uint64_t InputGenerator::sampleZipf(std::size_t index) const {
+    double probability = m_rng.unit(index);
+    std::size_t bucket = static_cast<std::size_t>(probability * static_cast<double>(m_zipfGuide.size()));
+    std::size_t rank = m_zipfGuide[bucket];
+    while (rank + 1 < m_zipfCdf.size() && m_zipfCdf[rank] < probability) {
+        ++rank;
+    }
+    return rank;
+}
+
+template <typename T>
+void InputGenerator::scatterSwaps(T* values, std::size_t count) const {
+    if (count < 2) {
+        return;
+    }
+    
+    std::size_t swaps = count / Config::GENERATOR_NEARLY_SORTED_SWAP_DIVISOR;
+    if (swaps == 0) {
+        swaps = 1;
+    }
+    
+    for (std::size_t swap = 0; swap < swaps; ++swap) {
+        std::size_t first = static_cast<std::size_t>(m_swapRng.at(2 * swap) % count);
+        std::size_t second = static_cast<std::size_t>(m_swapRng.at(2 * swap + 1) % count);
+        std::swap(values[first], values[second]);
+    }
+}
+
+template void InputGenerator::fill(Array& array, Distribution distribution, std::size_t count) const;
+template void InputGenerator::fill(Int64Array& array, Distribution distribution, std::size_t count) const;
+template void InputGenerator::fill(FloatArray& array, Distribution distribution, std::size_t count) const;
+template void InputGenerator::fill(DoubleArray& array, Distribution distribution, std::size_t count) const;
+template void InputGenerator::fill(RecordArray& array, Distribution distribution, std::size_t count) const;
+
+}
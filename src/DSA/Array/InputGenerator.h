@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Array.h"
+#include "CounterRng.h"
+#include "Distribution.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DSA {
+
+class InputGenerator {
+public:
+    InputGenerator(std::int64_t min, std::int64_t max, std::uint64_t seed);
+    
+    template <typename T>
+    void fill(BasicArray<T>& array, Distribution distribution, std::size_t count) const;
+    
+    static std::string getName(Distribution distribution);
+    static Distribution next(Distribution distribution);
+    static std::uint64_t randomSeed();
+
+private:
+    std::int64_t m_min;
+    std::int64_t m_max;
+    CounterRng m_rng;
+    CounterRng m_swapRng;
+    std::vector<double> m_zipfCdf;
+    std::vector<std::uint32_t> m_zipfGuide;
+    
+    std::int64_t keyAt(Distribution distribution, std::size_t index, std::size_t count) const;
+    std::int64_t level(std::uint64_t step, std::uint64_t levels) const;
+    std::uint64_t sampleZipf(std::size_t index) const;
+    
+    template <typename T>
+    void scatterSwaps(T* values, std::size_t count) const;
+};
+
+}
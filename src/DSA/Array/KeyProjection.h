@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ElementTraits.h"
+#include "../../App/Config.h"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace DSA {
+
+class KeyProjection {
+public:
+    KeyProjection()
+        : m_origin(0.0)
+        , m_scale(1.0)
+        , m_identity(true)
+    {}
+    
+    template <typename T>
+    static KeyProjection fit(const T* values, std::size_t count) {
+        KeyProjection projection;
+        if (std::is_same<T, int>::value || count == 0) {
+            return projection;
+        }
+        
+        double low = ElementTraits<T>::key(values[0]);
+        double high = low;
+        for (std::size_t i = 1; i < count; ++i) {
+            double key = ElementTraits<T>::key(values[i]);
+            low = key < low ? key : low;
+            high = key > high ? key : high;
+        }
+        
+        if (!std::is_floating_point<T>::value && low >= std::numeric_limits<int>::min()
+            && high <= std::numeric_limits<int>::max()) {
+            return projection;
+        }
+        
+        projection.m_identity = false;
+        projection.m_origin = low;
+        projection.m_scale = high > low
+            ? (Config::PROJECTED_KEY_MAX - Config::PROJECTED_KEY_MIN) / (high - low)
+            : 0.0;
+        return projection;
+    }
+    
+    template <typename T>
+    int operator()(const T& value) const {
+        if (m_identity) {
+            return static_cast<int>(ElementTraits<T>::display(value));
+        }
+        return Config::PROJECTED_KEY_MIN
+             + static_cast<int>(std::lround((ElementTraits<T>::key(value) - m_origin) * m_scale));
+    }
+    
+    bool isIdentity() const noexcept { return m_identity; }
+
+private:
+    double m_origin;
+    double m_scale;
+    bool m_identity;
+};
+
+}
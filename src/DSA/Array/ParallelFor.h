@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace DSA {
+
+inline std::size_t parallelWorkers(std::size_t count, std::size_t grain) {
+    std::size_t workers = std::thread::hardware_concurrency();
+    std::size_t chunks = grain > 0 ? count / grain : count;
+    if (workers > chunks) {
+        workers = chunks;
+    }
+    return workers > 0 ? workers : 1;
+}
+
+template <typename Body>
+void parallelChunks(std::size_t workers, Body body) {
+    if (workers <= 1) {
+        body(0);
+        return;
+    }
+    
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (std::size_t worker = 1; worker < workers; ++worker) {
+        threads.emplace_back(body, worker);
+    }
+    body(0);
+    
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+template <typename Body>
+void parallelFor(std::size_t count, std::size_t grain, Body body) {
+    std::size_t workers = parallelWorkers(count, grain);
+    std::size_t chunk = (count + workers - 1) / workers;
+    parallelChunks(workers, [&body, count, chunk](std::size_t worker) {
+        std::size_t begin = std::min(count, worker * chunk);
+        std::size_t end = std::min(count, begin + chunk);
+        body(begin, end);
+    });
+}
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace DSA {
+
+class ResizableResource : public std::pmr::memory_resource {
+public:
+    bool resize(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) {
+        return doResize(block, oldBytes, newBytes, alignment);
+    }
+
+private:
+    virtual bool doResize(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) = 0;
+};
+
+}
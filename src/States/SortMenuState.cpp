@@ -9,6 +9,9 @@
 #include "../DSA/Algorithms/Sorting/BubbleSort.h"
 #include "../DSA/Algorithms/Sorting/InsertionSort.h"
 #include "../DSA/Algorithms/Sorting/SelectionSort.h"
+#include "../DSA/Algorithms/Sorting/TopDownMergeSort.h"
+#include "../DSA/Algorithms/Sorting/BottomUpMergeSort.h"
+#include "../DSA/Algorithms/Sorting/NaturalMergeSort.h"
 #include "../UI/Theme/ThemeManager.h"
 #include "../App/Config.h"
 #include <SFML/Window/Keyboard.hpp>
@@ -46,10 +49,10 @@ void SortMenuState::setupButtons() {
     
     sf::Vector2u windowSize = m_context.getWindow().getSize();
     float centerX = static_cast<float>(windowSize.x) / 2.0f;
-    float startY = 150.0f;
+    float startY = 100.0f;
     float buttonWidth = 300.0f;
-    float buttonHeight = 60.0f;
-    float buttonSpacing = 20.0f;
+    float buttonHeight = 48.0f;
+    float buttonSpacing = 12.0f;
 
     auto bubbleSortBtn = std::make_unique<UI::Button>(
         sf::Vector2f(centerX - buttonWidth / 2.0f, startY),
@@ -75,9 +78,57 @@ void SortMenuState::setupButtons() {
     selectionSortBtn->setCallback([this]() { onSelectionSortClicked(); });
     m_buttons.push_back(std::move(selectionSortBtn));
 
-    auto backBtn = std::make_unique<UI::Button>(
+    auto topDownMergeSortBtn = std::make_unique<UI::Button>(
         sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 3 * (buttonHeight + buttonSpacing)),
         sf::Vector2f(buttonWidth, buttonHeight),
+        "Top-Down Merge Sort"
+    );
+    topDownMergeSortBtn->setCallback([this]() { onTopDownMergeSortClicked(); });
+    m_buttons.push_back(std::move(topDownMergeSortBtn));
+
+    auto bottomUpMergeSortBtn = std::make_unique<UI::Button>(
+        sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 4 * (buttonHeight + buttonSpacing)),
+        sf::Vector2f(buttonWidth, buttonHeight),
+        "Bottom-Up Merge Sort"
+    );
+    bottomUpMergeSortBtn->setCallback([this]() { onBottomUpMergeSortClicked(); });
+    m_buttons.push_back(std::move(bottomUpMergeSortBtn));
+
+    auto naturalMergeSortBtn = std::make_unique<UI::Button>(
+        sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 5 * (buttonHeight + buttonSpacing)),
+        sf::Vector2f(buttonWidth, buttonHeight),
+        "Natural Merge Sort"
+    );
+    naturalMergeSortBtn->setCallback([this]() { onNaturalMergeSortClicked(); });
+    m_buttons.push_back(std::move(naturalMergeSortBtn));
+
+    auto openTraceBtn = std::make_unique<UI::Button>(
+        sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 6 * (buttonHeight + buttonSpacing)),
+        sf::Vector2f(buttonWidth, buttonHeight),
+        "Open Saved Trace"
+    );
+    openTraceBtn->setCallback([this]() { onOpenTraceClicked(); });
+    m_buttons.push_back(std::move(openTraceBtn));
+
+    auto openDatasetBtn = std::make_unique<UI::Button>(
+        sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 7 * (buttonHeight + buttonSpacing)),
+        sf::Vector2f(buttonWidth, buttonHeight),
+        "Open Dataset"
+    );
+    openDatasetBtn->setCallback([this]() { onOpenDatasetClicked(); });
+    m_buttons.push_back(std::move(openDatasetBtn));
+
+    auto importDatasetBtn = std::make_unique<UI::Button>(
+        sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 8 * (buttonHeight + buttonSpacing)),
+        sf::Vector2f(buttonWidth, buttonHeight),
+        "Import CSV Dataset"
+    );
+    importDatasetBtn->setCallback([this]() { onImportDatasetClicked(); });
+    m_buttons.push_back(std::move(importDatasetBtn));
+
+    auto backBtn = std::make_unique<UI::Button>(
+        sf::Vector2f(centerX - buttonWidth / 2.0f, startY + 9 * (buttonHeight + buttonSpacing)),
+        sf::Vector2f(buttonWidth, buttonHeight),
         "Back"
     );
     backBtn->setCallback([this]() { onBackClicked(); });
@@ -207,6 +258,72 @@ void SortMenuState::onSelectionSortClicked() {
     eventBus.publish(visualizerEvent);
 }
 
+void SortMenuState::onTopDownMergeSortClicked() {
+    m_context.setSelectedSorter(std::make_unique<TopDownMergeSort>());
+    
+    if (m_algorithmCallback) {
+        m_algorithmCallback(std::make_unique<TopDownMergeSort>());
+    }
+    
+    EventBus& eventBus = m_context.getEventBus();
+    Event visualizerEvent(EventType::StateChanged);
+    visualizerEvent.setData(StateID::Visualizer);
+    eventBus.publish(visualizerEvent);
+}
+
+void SortMenuState::onBottomUpMergeSortClicked() {
+    m_context.setSelectedSorter(std::make_unique<BottomUpMergeSort>());
+    
+    if (m_algorithmCallback) {
+        m_algorithmCallback(std::make_unique<BottomUpMergeSort>());
+    }
+    
+    EventBus& eventBus = m_context.getEventBus();
+    Event visualizerEvent(EventType::StateChanged);
+    visualizerEvent.setData(StateID::Visualizer);
+    eventBus.publish(visualizerEvent);
+}
+
+void SortMenuState::onNaturalMergeSortClicked() {
+    m_context.setSelectedSorter(std::make_unique<NaturalMergeSort>());
+    
+    if (m_algorithmCallback) {
+        m_algorithmCallback(std::make_unique<NaturalMergeSort>());
+    }
+    
+    EventBus& eventBus = m_context.getEventBus();
+    Event visualizerEvent(EventType::StateChanged);
+    visualizerEvent.setData(StateID::Visualizer);
+    eventBus.publish(visualizerEvent);
+}
+
+void SortMenuState::onOpenTraceClicked() {
+    m_context.setSelectedTracePath(Config::TRACE_FILE_PATH);
+    
+    EventBus& eventBus = m_context.getEventBus();
+    Event visualizerEvent(EventType::StateChanged);
+    visualizerEvent.setData(StateID::Visualizer);
+    eventBus.publish(visualizerEvent);
+}
+
+void SortMenuState::onOpenDatasetClicked() {
+    m_context.setSelectedDatasetPath(Config::DATASET_FILE_PATH);
+    
+    EventBus& eventBus = m_context.getEventBus();
+    Event visualizerEvent(EventType::StateChanged);
+    visualizerEvent.setData(StateID::Visualizer);
+    eventBus.publish(visualizerEvent);
+}
+
+void SortMenuState::onImportDatasetClicked() {
+    m_context.setSelectedDatasetPath(Config::IMPORT_FILE_PATH);
+    
+    EventBus& eventBus = m_context.getEventBus();
+    Event visualizerEvent(EventType::StateChanged);
+    visualizerEvent.setData(StateID::Visualizer);
+    eventBus.publish(visualizerEvent);
+}
+
 void SortMenuState::onBackClicked() {
 
     EventBus& eventBus = m_context.getEventBus();
@@ -48,6 +48,12 @@ private:
     void onBubbleSortClicked();
     void onInsertionSortClicked();
     void onSelectionSortClicked();
+    void onTopDownMergeSortClicked();
+    void onBottomUpMergeSortClicked();
+    void onNaturalMergeSortClicked();
+    void onOpenTraceClicked();
+    void onOpenDatasetClicked();
+    void onImportDatasetClicked();
     void onBackClicked();
 
     UI::Label m_titleLabel;
@@ -5,9 +5,14 @@
 #include "../Core/Events/Event.h"
 #include "../Core/State/StateID.h"
 #include "../App/Config.h"
+#include "../DSA/Array/ArrayImporter.h"
+#include "../DSA/Array/InputGenerator.h"
 #include "../DSA/Algorithms/Sorting/BubbleSort.h"
 #include "../DSA/Algorithms/Sorting/InsertionSort.h"
 #include "../DSA/Algorithms/Sorting/SelectionSort.h"
+#include "../DSA/Algorithms/Sorting/TopDownMergeSort.h"
+#include "../DSA/Algorithms/Sorting/BottomUpMergeSort.h"
+#include "../DSA/Algorithms/Sorting/NaturalMergeSort.h"
 #include "../UI/Components/Slider.h"
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
@@ -19,16 +24,20 @@ namespace DSA {
 VisualizerState::VisualizerState(StateContext& context)
     : State(context)
     , m_array()
+    , m_distribution(Distribution::Uniform)
+    , m_elementType(ElementType::Int32)
     , m_sorter(nullptr)
     , m_executor()
     , m_renderer()
     , m_titleLabel(sf::Vector2f(0, 0))
     , m_statusLabel(sf::Vector2f(0, 0))
     , m_stepLabel(sf::Vector2f(0, 0))
+    , m_statsLabel(sf::Vector2f(0, 0))
     , m_playPauseButton(sf::Vector2f(0, 0), sf::Vector2f(120, 40), "Play")
     , m_resetButton(sf::Vector2f(0, 0), sf::Vector2f(120, 40), "Reset")
     , m_backButton(sf::Vector2f(0, 0), sf::Vector2f(120, 40), "Back")
     , m_speedSlider(sf::Vector2f(0, 0), 200.0f, Config::ANIMATION_MIN_SPEED, Config::ANIMATION_MAX_SPEED, Config::ANIMATION_DEFAULT_SPEED)
+    , m_seekSlider(sf::Vector2f(0, 0), 400.0f, 0.0f, 1.0f, 0.0f)
     , m_initialized(false)
 {
     m_renderer.addComponent(std::make_unique<Visual::BarComponent>());
@@ -38,7 +47,18 @@ VisualizerState::VisualizerState(StateContext& context)
 
 void VisualizerState::onEnter() {
     try {
-
+        
+        std::string datasetPath = m_context.takeSelectedDatasetPath();
+        if (!datasetPath.empty()) {
+            try {
+                m_array = ArrayImporter::load(datasetPath);
+                m_elementType = ElementType::Int32;
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Error opening dataset: " << e.what() << std::endl;
+            }
+        }
+        
         if (m_array.isEmpty()) {
             generateDefaultArray();
         }
@@ -54,11 +74,22 @@ void VisualizerState::onEnter() {
         
         std::unique_ptr<SorterBase> executorSorter = createSorterCopy(*m_sorter);
         m_executor.setSorter(std::move(executorSorter));
-        m_executor.setArray(m_array);
+        loadElements();
+        
+        std::string tracePath = m_context.takeSelectedTracePath();
+        if (!tracePath.empty()) {
+            try {
+                m_executor.loadTrace(tracePath);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Error loading trace: " << e.what() << std::endl;
+            }
+        }
         
-        m_renderer.setData(&m_array);
+        m_renderer.setData(m_executor.getCurrentView());
         
         initializeUI();
+        computeStats();
         
         m_initialized = true;
         std::cout << "VisualizerState entered" << std::endl;
@@ -78,28 +109,64 @@ void VisualizerState::handleInput(const sf::Event& event) {
     if (!m_initialized) {
         return;
     }
-
+    
     if (event.is<sf::Event::KeyPressed>()) {
         const auto* keyData = event.getIf<sf::Event::KeyPressed>();
         if (keyData) {
             if (keyData->code == sf::Keyboard::Key::Escape) {
-
+                
                 EventBus& eventBus = m_context.getEventBus();
                 Event pauseEvent(EventType::StatePushed);
                 pauseEvent.setData(StateID::PauseMenu);
                 eventBus.publish(pauseEvent);
             }
             else if (keyData->code == sf::Keyboard::Key::Space) {
-
+                
                 onPlayPauseClicked();
             }
             else if (keyData->code == sf::Keyboard::Key::R) {
-
+                
                 onResetClicked();
             }
+            else if (keyData->code == sf::Keyboard::Key::Left && keyData->shift) {
+                onJump(TraceEvent::Swap, false);
+            }
+            else if (keyData->code == sf::Keyboard::Key::Right && keyData->shift) {
+                onJump(TraceEvent::Swap, true);
+            }
+            else if (keyData->code == sf::Keyboard::Key::Left && keyData->control) {
+                onJump(TraceEvent::PassBoundary, false);
+            }
+            else if (keyData->code == sf::Keyboard::Key::Right && keyData->control) {
+                onJump(TraceEvent::PassBoundary, true);
+            }
+            else if (keyData->code == sf::Keyboard::Key::End) {
+                onJump(TraceEvent::Complete, true);
+            }
+            else if (keyData->code == sf::Keyboard::Key::Left) {
+                onStepBackward();
+            }
+            else if (keyData->code == sf::Keyboard::Key::Right) {
+                onStepForward();
+            }
+            else if (keyData->code == sf::Keyboard::Key::B) {
+                onReverseToggled();
+            }
+            else if (keyData->code == sf::Keyboard::Key::S) {
+                onSaveTrace();
+            }
+            else if (keyData->code == sf::Keyboard::Key::T) {
+                onTurboToggled();
+            }
+            else if (keyData->code == sf::Keyboard::Key::D) {
+                onDistributionCycled();
+            }
+            else if (keyData->code == sf::Keyboard::Key::E) {
+                onElementTypeCycled();
+            }
         }
     }
-
+    
     sf::Vector2i mousePosI = sf::Mouse::getPosition(m_context.getWindow());
     sf::Vector2f mousePos = sf::Vector2f(static_cast<float>(mousePosI.x), static_cast<float>(mousePosI.y));
     
@@ -107,6 +174,10 @@ void VisualizerState::handleInput(const sf::Event& event) {
         return;
     }
     
+    if (m_seekSlider.handleInput(event, mousePos)) {
+        return;
+    }
+    
     if (event.is<sf::Event::MouseButtonPressed>()) {
         const auto* mouseData = event.getIf<sf::Event::MouseButtonPressed>();
         if (mouseData && mouseData->button == sf::Mouse::Button::Left) {
@@ -127,18 +198,19 @@ void VisualizerState::update(float deltaTime) {
     if (!m_initialized) {
         return;
     }
-
+    
     m_executor.update(deltaTime);
-
+    
     sf::Vector2i mousePosI = sf::Mouse::getPosition(m_context.getWindow());
     sf::Vector2f mousePos = sf::Vector2f(mousePosI.x, mousePosI.y);
     m_playPauseButton.update(mousePos);
     m_resetButton.update(mousePos);
     m_backButton.update(mousePos);
     m_speedSlider.update(mousePos);
-
+    m_seekSlider.update(mousePos);
+    
     updateUI();
-
+    
     sf::Vector2u windowSize = m_context.getWindow().getSize();
     sf::FloatRect bounds(
         sf::Vector2f(50.0f, 150.0f),
@@ -152,29 +224,35 @@ void VisualizerState::render(sf::RenderTarget& target) {
     if (!m_initialized) {
         return;
     }
-
+    
     target.draw(m_background);
-
+    
     target.draw(m_infoPanel);
-
+    
     m_titleLabel.render(target);
     m_statusLabel.render(target);
     m_stepLabel.render(target);
-
+    m_statsLabel.render(target);
+    
     m_playPauseButton.render(target);
     m_resetButton.render(target);
     m_backButton.render(target);
     m_speedSlider.render(target);
+    m_seekSlider.render(target);
     
     const SortStep* currentStep = m_executor.getCurrentStep();
+    m_renderer.setData(m_executor.getCurrentView());
+    m_renderer.setAuxiliaryData(m_executor.getAuxiliaryView());
     m_renderer.render(target, currentStep);
 }
 
 void VisualizerState::setArray(const Array& array) {
     m_array = array;
+    m_elementType = ElementType::Int32;
     if (m_initialized) {
         m_executor.setArray(m_array);
-        m_renderer.setData(&m_array);
+        m_renderer.setData(m_executor.getCurrentView());
+        computeStats();
     }
 }
 
@@ -183,21 +261,22 @@ void VisualizerState::setSorter(std::unique_ptr<SorterBase> sorter) {
     if (m_initialized && m_sorter) {
         std::unique_ptr<SorterBase> executorSorter = createSorterCopy(*m_sorter);
         m_executor.setSorter(std::move(executorSorter));
-        m_executor.setArray(m_array);
-        m_renderer.setData(&m_array);
+        loadElements();
+        m_renderer.setData(m_executor.getCurrentView());
+        computeStats();
     }
 }
 
 void VisualizerState::initializeUI() {
     sf::Vector2u windowSize = m_context.getWindow().getSize();
-
+    
     m_background.setSize(sf::Vector2f(windowSize.x, windowSize.y));
     m_background.setFillColor(sf::Color(
         Config::Colors::BACKGROUND_R,
         Config::Colors::BACKGROUND_G,
         Config::Colors::BACKGROUND_B
     ));
-
+    
     m_infoPanel.setSize(sf::Vector2f(windowSize.x, 100.0f));
     m_infoPanel.setPosition(sf::Vector2f(0, 0));
     m_infoPanel.setFillColor(sf::Color(
@@ -206,26 +285,31 @@ void VisualizerState::initializeUI() {
         Config::Colors::PRIMARY_B,
         240
     ));
-
+    
     m_titleLabel.setText("Bubble Sort");
     m_titleLabel.setPosition(sf::Vector2f(static_cast<float>(windowSize.x) / 2.0f - 100.0f, 20.0f));
     m_titleLabel.setFontSize(32);
     m_titleLabel.setColor(sf::Color::White);
-
+    
     m_statusLabel.setText("Ready");
     m_statusLabel.setPosition(sf::Vector2f(20, 75));
     m_statusLabel.setColor(sf::Color(200, 220, 255));
     m_statusLabel.setFontSize(18);
-
+    
     m_stepLabel.setText("Step: 0 / 0");
     m_stepLabel.setPosition(sf::Vector2f(static_cast<float>(windowSize.x) - 200.0f, 60.0f));
     m_stepLabel.setColor(sf::Color::White);
-
+    
     m_speedSlider.setPosition(sf::Vector2f(500.0f, static_cast<float>(windowSize.y) - 50.0f));
     m_speedSlider.setCallback([this](float speed) {
         m_executor.setSpeed(speed);
     });
-
+    
+    m_seekSlider.setPosition(sf::Vector2f(760.0f, static_cast<float>(windowSize.y) - 50.0f));
+    m_seekSlider.setCallback([this](float progress) {
+        onSeek(progress);
+    });
+    
     float buttonY = static_cast<float>(windowSize.y) - 60.0f;
     m_playPauseButton.setPosition(sf::Vector2f(50.0f, buttonY));
     m_playPauseButton.setCallback([this]() { onPlayPauseClicked(); });
@@ -235,7 +319,7 @@ void VisualizerState::initializeUI() {
     
     m_backButton.setPosition(sf::Vector2f(310.0f, buttonY));
     m_backButton.setCallback([this]() { onBackClicked(); });
-
+    
     sf::FloatRect bounds(
         sf::Vector2f(50.0f, 150.0f),
         sf::Vector2f(static_cast<float>(windowSize.x) - 100.0f,
@@ -245,7 +329,7 @@ void VisualizerState::initializeUI() {
 }
 
 void VisualizerState::updateUI() {
-
+    
     std::string algorithmName = m_executor.getAlgorithmName();
     if (!algorithmName.empty()) {
         m_titleLabel.setText(algorithmName);
@@ -258,14 +342,14 @@ void VisualizerState::updateUI() {
         m_titleLabel.setFontSize(42);
         m_titleLabel.setColor(sf::Color(255, 255, 100));
     }
-
+    
     std::string statusText;
     switch (m_executor.getState()) {
         case AlgorithmExecutor::State::Idle:
             statusText = "Ready";
             break;
         case AlgorithmExecutor::State::Running:
-            statusText = "Running";
+            statusText = m_executor.isReverse() ? "Rewinding" : "Running";
             break;
         case AlgorithmExecutor::State::Paused:
             statusText = "Paused";
@@ -274,21 +358,43 @@ void VisualizerState::updateUI() {
             statusText = "Completed!";
             break;
     }
+    if (!m_executor.isTraceLoaded()) {
+        statusText += " - " + InputGenerator::getName(m_distribution) + " "
+                    + getElementTypeName(m_elementType) + " input";
+    }
+    if (m_executor.isTurbo()) {
+        statusText += " [Turbo " + std::to_string(static_cast<long long>(m_executor.getStepsPerSecond())) + " steps/s]";
+    }
+    if (m_executor.getState() != AlgorithmExecutor::State::Idle && !m_executor.isTraceComplete()) {
+        statusText += " (generating " + std::to_string(m_executor.getGeneratedSteps()) + " steps)";
+    }
     m_statusLabel.setText(statusText);
     m_statusLabel.setPosition(sf::Vector2f(20, 75));
     m_statusLabel.setColor(sf::Color(200, 220, 255));
     m_statusLabel.setFontSize(18);
-
+    
     std::ostringstream stepText;
     stepText << "Step: " << (m_executor.getCurrentStepIndex() + 1) 
              << " / " << m_executor.getTotalSteps();
+    if (!m_executor.isTraceComplete()) {
+        stepText << "+";
+    }
     m_stepLabel.setText(stepText.str());
     sf::Vector2u windowSize = m_context.getWindow().getSize();
     sf::FloatRect stepBounds = m_stepLabel.getLocalBounds();
     m_stepLabel.setPosition(sf::Vector2f(static_cast<float>(windowSize.x) - stepBounds.size.x - 20.0f, 75.0f));
     m_stepLabel.setColor(sf::Color(200, 220, 255));
     m_stepLabel.setFontSize(18);
-
+    
+    sf::FloatRect statsBounds = m_statsLabel.getLocalBounds();
+    m_statsLabel.setPosition(sf::Vector2f(static_cast<float>(windowSize.x) - stepBounds.size.x - statsBounds.size.x - 50.0f, 75.0f));
+    m_statsLabel.setColor(sf::Color(200, 220, 255));
+    m_statsLabel.setFontSize(18);
+    
+    if (!m_seekSlider.isDragging()) {
+        m_seekSlider.setValue(m_executor.getProgress());
+    }
+    
     if (m_executor.getState() == AlgorithmExecutor::State::Running) {
         m_playPauseButton.setText("Pause");
     } else {
@@ -302,7 +408,7 @@ void VisualizerState::onPlayPauseClicked() {
     } else if (m_executor.getState() == AlgorithmExecutor::State::Paused) {
         m_executor.resume();
     } else {
-
+        
         m_executor.start();
     }
 }
@@ -313,13 +419,165 @@ void VisualizerState::onResetClicked() {
 }
 
 void VisualizerState::onBackClicked() {
-
+    
     EventBus& eventBus = m_context.getEventBus();
     Event backEvent(EventType::StateChanged);
     backEvent.setData(StateID::MainMenu);
     eventBus.publish(backEvent);
 }
 
+void VisualizerState::onSeek(float progress) {
+    m_executor.seekToProgress(progress);
+    updateUI();
+}
+
+void VisualizerState::onStepBackward() {
+    m_executor.pause();
+    m_executor.stepBackward();
+    updateUI();
+}
+
+void VisualizerState::onStepForward() {
+    m_executor.pause();
+    m_executor.stepForward();
+    updateUI();
+}
+
+void VisualizerState::onJump(TraceEvent event, bool forward) {
+    m_executor.pause();
+    if (forward) {
+        m_executor.jumpToNext(event);
+    } else {
+        m_executor.jumpToPrevious(event);
+    }
+    updateUI();
+}
+
+void VisualizerState::onReverseToggled() {
+    m_executor.setReverse(!m_executor.isReverse());
+    if (m_executor.getState() == AlgorithmExecutor::State::Paused) {
+        m_executor.resume();
+    }
+    updateUI();
+}
+
+void VisualizerState::onTurboToggled() {
+    m_executor.setTurbo(!m_executor.isTurbo());
+    updateUI();
+}
+
+void VisualizerState::onDistributionCycled() {
+    try {
+        m_distribution = InputGenerator::next(m_distribution);
+        m_array.generate(m_distribution, Config::ARRAY_DEFAULT_SIZE,
+                         Config::ARRAY_MIN_VALUE, Config::ARRAY_MAX_VALUE,
+                         Config::GENERATOR_DEFAULT_SEED);
+        loadElements();
+        m_renderer.setData(m_executor.getCurrentView());
+        computeStats();
+        updateUI();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error generating input: " << e.what() << std::endl;
+    }
+}
+
+void VisualizerState::onElementTypeCycled() {
+    try {
+        m_elementType = nextElementType(m_elementType);
+        loadElements();
+        m_renderer.setData(m_executor.getCurrentView());
+        computeStats();
+        updateUI();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error generating input: " << e.what() << std::endl;
+    }
+}
+
+void VisualizerState::loadElements() {
+    switch (m_elementType) {
+        case ElementType::Int64:
+            m_executor.setArray(generateElements<std::int64_t>().view());
+            break;
+        case ElementType::Float:
+            m_executor.setArray(generateElements<float>().view());
+            break;
+        case ElementType::Double:
+            m_executor.setArray(generateElements<double>().view());
+            break;
+        case ElementType::Record:
+            m_executor.setArray(generateElements<KeyedRecord>().view());
+            break;
+        default:
+            m_executor.setArray(m_array);
+            break;
+    }
+}
+
+void VisualizerState::onSaveTrace() {
+    try {
+        if (m_executor.saveTrace(Config::TRACE_FILE_PATH)) {
+            std::cout << "Trace saved to " << Config::TRACE_FILE_PATH << std::endl;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error saving trace: " << e.what() << std::endl;
+    }
+}
+
+void VisualizerState::computeStats() {
+    if (m_executor.isTraceLoaded() || !m_sorter) {
+        m_statsLabel.setText("");
+        return;
+    }
+    
+    switch (m_elementType) {
+        case ElementType::Int64:
+            showStats(generateElements<std::int64_t>());
+            break;
+        case ElementType::Float:
+            showStats(generateElements<float>());
+            break;
+        case ElementType::Double:
+            showStats(generateElements<double>());
+            break;
+        case ElementType::Record:
+            showStats(generateElements<KeyedRecord>());
+            break;
+        default:
+            showStats(m_array);
+            break;
+    }
+}
+
+template <typename T>
+void VisualizerState::showStats(const BasicArray<T>& values) {
+    if (values.size() > Config::STATS_MAX_ELEMENTS) {
+        std::ostringstream runsText;
+        runsText << "Ascending runs: " << values.countRuns();
+        m_statsLabel.setText(runsText.str());
+        return;
+    }
+    
+    SortStats stats = m_sorter->countOperations(values.view());
+    std::ostringstream statsText;
+    statsText << "Comparisons: " << stats.comparisons
+              << "  Swaps: " << stats.swaps
+              << "  Writes: " << stats.writes
+              << "  Passes: " << stats.passes;
+    m_statsLabel.setText(statsText.str());
+}
+
+template <typename T>
+BasicArray<T> VisualizerState::generateElements() const {
+    BasicArray<T> values;
+    values.generate(m_distribution, Config::ARRAY_DEFAULT_SIZE,
+                    Config::ARRAY_WIDE_MIN_VALUE, Config::ARRAY_WIDE_MAX_VALUE,
+                    Config::GENERATOR_DEFAULT_SEED);
+    return values;
+}
+
 void VisualizerState::generateDefaultArray() {
     m_array.generateRandom(Config::ARRAY_DEFAULT_SIZE,
                           Config::ARRAY_MIN_VALUE,
@@ -334,6 +592,12 @@ std::unique_ptr<SorterBase> VisualizerState::createSorterCopy(const SorterBase&
         return std::make_unique<InsertionSort>();
     } else if (name == "Selection Sort") {
         return std::make_unique<SelectionSort>();
+    } else if (name == "Top-Down Merge Sort") {
+        return std::make_unique<TopDownMergeSort>();
+    } else if (name == "Bottom-Up Merge Sort") {
+        return std::make_unique<BottomUpMergeSort>();
+    } else if (name == "Natural Merge Sort") {
+        return std::make_unique<NaturalMergeSort>();
     }
     return std::make_unique<BubbleSort>();
 }
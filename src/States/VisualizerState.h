@@ -3,6 +3,8 @@
 #include "../Core/State/State.h"
 #include "../Core/State/StateID.h"
 #include "../DSA/Array/Array.h"
+#include "../DSA/Array/Distribution.h"
+#include "../DSA/Array/ElementType.h"
 #include "../DSA/Algorithms/AlgorithmExecutor.h"
 #include "../DSA/Algorithms/Sorting/SorterBase.h"
 #include "../Visual/VisualizationRenderer.h"
@@ -31,6 +33,8 @@ public:
 
 private:
     Array m_array;
+    Distribution m_distribution;
+    ElementType m_elementType;
     std::unique_ptr<SorterBase> m_sorter;
     AlgorithmExecutor m_executor;
     Visual::VisualizationRenderer m_renderer;
@@ -38,10 +42,12 @@ private:
     UI::Label m_titleLabel;
     UI::Label m_statusLabel;
     UI::Label m_stepLabel;
+    UI::Label m_statsLabel;
     UI::Button m_playPauseButton;
     UI::Button m_resetButton;
     UI::Button m_backButton;
     UI::Slider m_speedSlider;
+    UI::Slider m_seekSlider;
     
     sf::RectangleShape m_background;
     sf::RectangleShape m_infoPanel;
@@ -53,6 +59,21 @@ private:
     void onPlayPauseClicked();
     void onResetClicked();
     void onBackClicked();
+    void onSeek(float progress);
+    void onStepBackward();
+    void onStepForward();
+    void onJump(TraceEvent event, bool forward);
+    void onReverseToggled();
+    void onSaveTrace();
+    void onTurboToggled();
+    void onDistributionCycled();
+    void onElementTypeCycled();
+    void loadElements();
+    void computeStats();
+    template <typename T>
+    void showStats(const BasicArray<T>& values);
+    template <typename T>
+    BasicArray<T> generateElements() const;
     void generateDefaultArray();
     std::unique_ptr<SorterBase> createSorterCopy(const SorterBase& sorter);
 };
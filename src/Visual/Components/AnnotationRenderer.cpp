@@ -9,7 +9,8 @@ namespace DSA {
 namespace Visual {
 
 AnnotationComponent::AnnotationComponent()
-    : m_panelX(0.0f)
+    : m_array()
+    , m_panelX(0.0f)
     , m_panelY(0.0f)
     , m_panelWidth(220.0f)
     , m_panelSpacing(8.0f)
@@ -19,6 +20,10 @@ AnnotationComponent::AnnotationComponent()
     m_background.setOutlineThickness(2.0f);
 }
 
+void AnnotationComponent::setData(ArrayView data) {
+    m_array = data;
+}
+
 void AnnotationComponent::updateLayout(const sf::FloatRect& bounds) {
     m_panelX = bounds.position.x + bounds.size.x - m_panelWidth - 20.0f;
     m_panelY = bounds.position.y + 120.0f;
@@ -72,106 +77,113 @@ void AnnotationComponent::render(sf::RenderTarget& target, const DSA::SortStep*
 void AnnotationComponent::createAnnotationLabels(const DSA::SortStep* step) const {
     m_annotationLabels.clear();
     
-    bool hasKey = false;
-    bool hasMin = false;
-    bool hasMax = false;
+    DSA::AnnotationKey shown[DSA::RoleSet::INLINE_CAPACITY] = {};
+    std::size_t shownCount = 0;
     
-    for (const auto& [idx, role] : step->roles) {
-        if (idx < step->arrayState.size()) {
-            int value = step->arrayState[idx];
-            
-            if (role == DSA::ElementRole::Key && !hasKey) {
-                std::string labelText = getAnnotationLabel("key", std::to_string(value));
-                auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
-                label->setColor(getAnnotationColor("key"));
-                label->setFontSize(22);
-                m_annotationLabels.push_back(std::move(label));
-                hasKey = true;
-            } else if (role == DSA::ElementRole::Minimum && !hasMin) {
-                std::string labelText = getAnnotationLabel("minimum", std::to_string(value));
-                auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
-                label->setColor(getAnnotationColor("minimum"));
-                label->setFontSize(22);
-                m_annotationLabels.push_back(std::move(label));
-                hasMin = true;
-            } else if (role == DSA::ElementRole::Maximum && !hasMax) {
-                std::string labelText = getAnnotationLabel("maximum", std::to_string(value));
-                auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
-                label->setColor(getAnnotationColor("maximum"));
-                label->setFontSize(22);
-                m_annotationLabels.push_back(std::move(label));
-                hasMax = true;
+    for (const DSA::RoleSet::Entry& entry : step->roles) {
+        DSA::AnnotationKey key = getRoleAnnotationKey(entry.role);
+        if (key == DSA::AnnotationKey::None || entry.index >= m_array.size()) {
+            continue;
+        }
+        
+        bool alreadyShown = false;
+        for (std::size_t i = 0; i < shownCount; ++i) {
+            if (shown[i] == key) {
+                alreadyShown = true;
+                break;
             }
         }
+        
+        if (!alreadyShown) {
+            addAnnotationLabel(key, m_array[entry.index]);
+            shown[shownCount++] = key;
+        }
     }
     
-    if (step->hasAnnotation("key") && !hasKey) {
-        std::string labelText = getAnnotationLabel("key", step->getAnnotation("key"));
-        auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
-        label->setColor(getAnnotationColor("key"));
-        label->setFontSize(22);
-        m_annotationLabels.push_back(std::move(label));
-    }
-    
-    if (step->hasAnnotation("minimum") && !hasMin) {
-        std::string labelText = getAnnotationLabel("minimum", step->getAnnotation("minimum"));
-        auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
-        label->setColor(getAnnotationColor("minimum"));
-        label->setFontSize(22);
-        m_annotationLabels.push_back(std::move(label));
+    for (const DSA::AnnotationSet::Entry& entry : step->annotations) {
+        bool alreadyShown = false;
+        for (std::size_t i = 0; i < shownCount; ++i) {
+            if (shown[i] == entry.key) {
+                alreadyShown = true;
+                break;
+            }
+        }
+        
+        if (!alreadyShown) {
+            addAnnotationLabel(entry.key, entry.value);
+        }
     }
-    
-    if (step->hasAnnotation("maximum") && !hasMax) {
-        std::string labelText = getAnnotationLabel("maximum", step->getAnnotation("maximum"));
-        auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
-        label->setColor(getAnnotationColor("maximum"));
-        label->setFontSize(22);
-        m_annotationLabels.push_back(std::move(label));
+}
+
+void AnnotationComponent::addAnnotationLabel(DSA::AnnotationKey key, std::int64_t value) const {
+    std::string labelText = getAnnotationLabel(key, value);
+    auto label = std::make_unique<UI::Label>(sf::Vector2f(0, 0), labelText);
+    label->setColor(getAnnotationColor(key));
+    label->setFontSize(22);
+    m_annotationLabels.push_back(std::move(label));
+}
+
+DSA::AnnotationKey AnnotationComponent::getRoleAnnotationKey(DSA::ElementRole role) const {
+    switch (role) {
+        case DSA::ElementRole::Key:
+            return DSA::AnnotationKey::Key;
+        case DSA::ElementRole::Minimum:
+            return DSA::AnnotationKey::Minimum;
+        case DSA::ElementRole::Maximum:
+            return DSA::AnnotationKey::Maximum;
+        default:
+            return DSA::AnnotationKey::None;
     }
 }
 
-std::string AnnotationComponent::getAnnotationLabel(const std::string& key, const std::string& value) const {
-    if (key == "key") {
-        return "Key: " + value;
-    } else if (key == "minimum") {
-        return "Minimum: " + value;
-    } else if (key == "maximum") {
-        return "Maximum: " + value;
+std::string AnnotationComponent::getAnnotationLabel(DSA::AnnotationKey key, std::int64_t value) const {
+    std::string valueText = std::to_string(value);
+    switch (key) {
+        case DSA::AnnotationKey::Key:
+            return "Key: " + valueText;
+        case DSA::AnnotationKey::Minimum:
+            return "Minimum: " + valueText;
+        case DSA::AnnotationKey::Maximum:
+            return "Maximum: " + valueText;
+        default:
+            return DSA::AnnotationRegistry::getInstance().getName(key) + ": " + valueText;
     }
-    return key + ": " + value;
 }
 
 std::string AnnotationComponent::getAnnotationTitle(const DSA::SortStep* step) const {
-    for (const auto& [idx, role] : step->roles) {
-        if (role == DSA::ElementRole::Key) {
+    for (const DSA::RoleSet::Entry& entry : step->roles) {
+        DSA::AnnotationKey key = getRoleAnnotationKey(entry.role);
+        if (key == DSA::AnnotationKey::Key) {
             return "Current Key";
-        } else if (role == DSA::ElementRole::Minimum) {
+        } else if (key == DSA::AnnotationKey::Minimum) {
             return "Current Minimum";
-        } else if (role == DSA::ElementRole::Maximum) {
+        } else if (key == DSA::AnnotationKey::Maximum) {
             return "Current Maximum";
         }
     }
     
-    if (step->hasAnnotation("key")) {
+    if (step->hasAnnotation(DSA::AnnotationKey::Key)) {
         return "Current Key";
-    } else if (step->hasAnnotation("minimum")) {
+    } else if (step->hasAnnotation(DSA::AnnotationKey::Minimum)) {
         return "Current Minimum";
-    } else if (step->hasAnnotation("maximum")) {
+    } else if (step->hasAnnotation(DSA::AnnotationKey::Maximum)) {
         return "Current Maximum";
     }
     
     return "";
 }
 
-sf::Color AnnotationComponent::getAnnotationColor(const std::string& key) const {
-    if (key == "key") {
-        return sf::Color(Config::Colors::KEY_R, Config::Colors::KEY_G, Config::Colors::KEY_B);
-    } else if (key == "minimum") {
-        return sf::Color(Config::Colors::MINIMUM_R, Config::Colors::MINIMUM_G, Config::Colors::MINIMUM_B);
-    } else if (key == "maximum") {
-        return sf::Color(Config::Colors::MINIMUM_R, Config::Colors::MINIMUM_G, Config::Colors::MINIMUM_B);
+sf::Color AnnotationComponent::getAnnotationColor(DSA::AnnotationKey key) const {
+    switch (key) {
+        case DSA::AnnotationKey::Key:
+            return sf::Color(Config::Colors::KEY_R, Config::Colors::KEY_G, Config::Colors::KEY_B);
+        case DSA::AnnotationKey::Minimum:
+            return sf::Color(Config::Colors::MINIMUM_R, Config::Colors::MINIMUM_G, Config::Colors::MINIMUM_B);
+        case DSA::AnnotationKey::Maximum:
+            return sf::Color(Config::Colors::MINIMUM_R, Config::Colors::MINIMUM_G, Config::Colors::MINIMUM_B);
+        default:
+            return sf::Color::White;
     }
-    return sf::Color::White;
 }
 
 }
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "IVisualizationComponent.h"
+#include "DSA/Array/ArrayView.h"
 #include "UI/Components/Label.h"
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 namespace DSA {
 namespace Visual {
@@ -17,8 +19,12 @@ public:
     
     void updateLayout(const sf::FloatRect& bounds) override;
     void render(sf::RenderTarget& target, const DSA::SortStep* step) const override;
+    
+    void setData(ArrayView data) override;
+    bool requiresData() const override { return true; }
 
 private:
+    ArrayView m_array;
     float m_panelX;
     float m_panelY;
     float m_panelWidth;
@@ -28,8 +34,10 @@ private:
     mutable std::vector<std::unique_ptr<UI::Label>> m_annotationLabels;
     
     void createAnnotationLabels(const DSA::SortStep* step) const;
-    std::string getAnnotationLabel(const std::string& key, const std::string& value) const;
-    sf::Color getAnnotationColor(const std::string& key) const;
+    void addAnnotationLabel(DSA::AnnotationKey key, std::int64_t value) const;
+    DSA::AnnotationKey getRoleAnnotationKey(DSA::ElementRole role) const;
+    std::string getAnnotationLabel(DSA::AnnotationKey key, std::int64_t value) const;
+    sf::Color getAnnotationColor(DSA::AnnotationKey key) const;
     std::string getAnnotationTitle(const DSA::SortStep* step) const;
 };
 
@@ -2,6 +2,7 @@
 #include "App/Config.h"
 #include "UI/Theme/ThemeManager.h"
 #include "Core/Resources/ResourceManager.h"
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
@@ -9,52 +10,81 @@ namespace DSA {
 namespace Visual {
 
 BarComponent::BarComponent()
-    : m_array(nullptr)
+    : m_array()
+    , m_auxiliary()
+    , m_bounds()
     , m_barWidth(20.0f)
     , m_spacing(5.0f)
     , m_baseY(600.0f)
     , m_startX(50.0f)
     , m_maxHeight(500.0f)
+    , m_auxiliaryBaseY(600.0f)
+    , m_auxiliaryMaxHeight(0.0f)
     , m_maxValue(100)
+    , m_visibleCount(Config::ARRAY_MAX_SIZE)
 {
 }
 
-void BarComponent::setData(const void* data) {
-    m_array = static_cast<const Array*>(data);
-    if (m_array) {
-        m_maxValue = findMaxValue();
+void BarComponent::setData(ArrayView data) {
+    m_array = data;
+    m_maxValue = findMaxValue();
+}
+
+void BarComponent::setAuxiliaryData(ArrayView data) {
+    bool rowsChanged = data.isEmpty() != m_auxiliary.isEmpty();
+    m_auxiliary = data;
+    if (rowsChanged) {
+        updateRows();
     }
 }
 
 void BarComponent::updateLayout(const sf::FloatRect& bounds) {
-    if (!m_array || m_array->isEmpty()) {
+    m_bounds = bounds;
+    if (m_array.isEmpty()) {
         return;
     }
     
-    std::size_t arraySize = m_array->size();
+    std::size_t arraySize = m_array.size();
     float availableWidth = bounds.size.x;
     float totalSpacing = (arraySize - 1) * m_spacing;
     m_barWidth = (availableWidth - totalSpacing) / static_cast<float>(arraySize);
     
+    std::size_t visibleCount = arraySize;
     if (m_barWidth < 5.0f) {
         m_barWidth = 5.0f;
+        std::size_t fittingBars = static_cast<std::size_t>((availableWidth + m_spacing) / (m_barWidth + m_spacing));
+        visibleCount = std::min(arraySize, std::max<std::size_t>(1, fittingBars));
     }
     if (m_barWidth > 50.0f) {
         m_barWidth = 50.0f;
     }
     
+    if (visibleCount != m_visibleCount) {
+        m_visibleCount = visibleCount;
+        m_maxValue = findMaxValue();
+    }
+    
     m_startX = bounds.position.x;
-    m_baseY = bounds.position.y + bounds.size.y - 20.0f;
-    m_maxHeight = bounds.size.y - 40.0f;
+    updateRows();
+}
+
+void BarComponent::updateRows() {
+    float auxiliaryHeight = m_auxiliary.isEmpty() ? 0.0f : m_bounds.size.y * 0.35f;
+    float mainHeight = m_bounds.size.y - auxiliaryHeight;
+    
+    m_baseY = m_bounds.position.y + mainHeight - 20.0f;
+    m_maxHeight = mainHeight - 40.0f;
+    m_auxiliaryBaseY = m_bounds.position.y + m_bounds.size.y - 10.0f;
+    m_auxiliaryMaxHeight = std::max(0.0f, auxiliaryHeight - 40.0f);
 }
 
 void BarComponent::render(sf::RenderTarget& target, const DSA::SortStep* step) const {
-    if (!m_array || m_array->isEmpty()) {
+    if (m_array.isEmpty()) {
         return;
     }
     
-    std::size_t size = m_array->size();
-    const Array& arrayToRender = step ? step->arrayState : *m_array;
+    std::size_t size = std::min(m_array.size(), m_visibleCount);
+    ArrayView arrayToRender = m_array;
     
     m_valueLabels.clear();
     m_valueLabels.reserve(size);
@@ -101,10 +131,43 @@ void BarComponent::render(sf::RenderTarget& target, const DSA::SortStep* step) c
             m_valueLabels.back()->setPosition(sf::Vector2f(textX, textY));
             m_valueLabels.back()->render(target);
         }
+        
+        if (!m_auxiliary.isEmpty()) {
+            renderAuxiliary(target, step, std::min(m_auxiliary.size(), size));
+        }
     } catch (...) {
     }
 }
 
+void BarComponent::renderAuxiliary(sf::RenderTarget& target, const DSA::SortStep* step, std::size_t count) const {
+    std::ostringstream caption;
+    caption << "Auxiliary buffer: " << m_auxiliary.size() << " elements ("
+            << m_auxiliary.size() * sizeof(int) << " bytes extra)";
+    
+    UI::Label captionLabel(sf::Vector2f(m_startX, m_auxiliaryBaseY - m_auxiliaryMaxHeight - 26.0f), caption.str());
+    captionLabel.setColor(sf::Color(Config::Colors::TEXT_R,
+                                    Config::Colors::TEXT_G,
+                                    Config::Colors::TEXT_B));
+    captionLabel.setFontSize(14);
+    captionLabel.render(target);
+    
+    for (std::size_t i = 0; i < count; ++i) {
+        float ratio = static_cast<float>(m_auxiliary[i]) / static_cast<float>(m_maxValue);
+        float height = std::max(0.0f, std::min(1.0f, ratio)) * m_auxiliaryMaxHeight;
+        float x = m_startX + static_cast<float>(i) * (m_barWidth + m_spacing);
+        
+        sf::RectangleShape bar(sf::Vector2f(m_barWidth, height));
+        bar.setPosition(sf::Vector2f(x, m_auxiliaryBaseY - height));
+        bar.setFillColor(getAuxiliaryBarColor(i, step));
+        bar.setOutlineColor(sf::Color(Config::Colors::TEXT_R,
+                                      Config::Colors::TEXT_G,
+                                      Config::Colors::TEXT_B));
+        bar.setOutlineThickness(1.0f);
+        
+        target.draw(bar);
+    }
+}
+
 float BarComponent::calculateBarHeight(int value) const {
     if (m_maxValue == 0) {
         return 0.0f;
@@ -164,10 +227,12 @@ sf::Color BarComponent::getBarColor(std::size_t index, const DSA::SortStep* step
     }
     
     bool isInvolved = false;
-    for (std::size_t idx : step->indices) {
-        if (idx == index) {
-            isInvolved = true;
-            break;
+    if (step->buffer == DSA::StepBuffer::Main) {
+        for (std::size_t idx : step->indices) {
+            if (idx == index) {
+                isInvolved = true;
+                break;
+            }
         }
     }
     
@@ -199,17 +264,35 @@ sf::Color BarComponent::getBarColor(std::size_t index, const DSA::SortStep* step
                     Config::Colors::SECONDARY_B);
 }
 
+sf::Color BarComponent::getAuxiliaryBarColor(std::size_t index, const DSA::SortStep* step) const {
+    if (step && step->buffer == DSA::StepBuffer::Auxiliary) {
+        for (std::size_t idx : step->indices) {
+            if (idx != index) {
+                continue;
+            }
+            if (step->type == DSA::StepType::Compare) {
+                return sf::Color(Config::Colors::WARNING_R,
+                               Config::Colors::WARNING_G,
+                               Config::Colors::WARNING_B);
+            }
+            return sf::Color(Config::Colors::KEY_R,
+                           Config::Colors::KEY_G,
+                           Config::Colors::KEY_B);
+        }
+    }
+    
+    return sf::Color(Config::Colors::PRIMARY_R,
+                    Config::Colors::PRIMARY_G,
+                    Config::Colors::PRIMARY_B);
+}
+
 int BarComponent::findMaxValue() const {
-    if (!m_array || m_array->isEmpty()) {
+    if (m_array.isEmpty()) {
         return 1;
     }
     
-    int maxVal = (*m_array)[0];
-    for (std::size_t i = 1; i < m_array->size(); ++i) {
-        if ((*m_array)[i] > maxVal) {
-            maxVal = (*m_array)[i];
-        }
-    }
+    std::size_t count = std::min(m_array.size(), m_visibleCount);
+    int maxVal = m_array.subview(0, count).minMax().second;
     
     return maxVal > 0 ? maxVal : 1;
 }
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "IVisualizationComponent.h"
-#include "DSA/Array/Array.h"
+#include "DSA/Array/ArrayView.h"
 #include "UI/Components/Label.h"
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
@@ -22,20 +22,29 @@ public:
     void updateLayout(const sf::FloatRect& bounds) override;
     void render(sf::RenderTarget& target, const DSA::SortStep* step) const override;
     
-    void setData(const void* data) override;
+    void setData(ArrayView data) override;
+    void setAuxiliaryData(ArrayView data) override;
     bool requiresData() const override { return true; }
 
 private:
-    const Array* m_array;
+    ArrayView m_array;
+    ArrayView m_auxiliary;
+    sf::FloatRect m_bounds;
     float m_barWidth;
     float m_spacing;
     float m_baseY;
     float m_startX;
     float m_maxHeight;
+    float m_auxiliaryBaseY;
+    float m_auxiliaryMaxHeight;
     int m_maxValue;
+    std::size_t m_visibleCount;
     
+    void updateRows();
+    void renderAuxiliary(sf::RenderTarget& target, const DSA::SortStep* step, std::size_t count) const;
     float calculateBarHeight(int value) const;
     sf::Color getBarColor(std::size_t index, const DSA::SortStep* step) const;
+    sf::Color getAuxiliaryBarColor(std::size_t index, const DSA::SortStep* step) const;
     int findMaxValue() const;
     
     mutable std::vector<std::unique_ptr<UI::Label>> m_valueLabels;
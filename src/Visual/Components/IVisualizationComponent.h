@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DSA/Algorithms/Sorting/SortStep.h"
+#include "DSA/Array/ArrayView.h"
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
@@ -14,7 +15,8 @@ public:
     virtual void updateLayout(const sf::FloatRect& bounds) = 0;
     virtual void render(sf::RenderTarget& target, const DSA::SortStep* step) const = 0;
     
-    virtual void setData(const void* data) { (void)data; }
+    virtual void setData(ArrayView data) { (void)data; }
+    virtual void setAuxiliaryData(ArrayView data) { (void)data; }
     virtual bool requiresData() const { return false; }
 };
 
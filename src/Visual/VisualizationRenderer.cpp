@@ -33,7 +33,7 @@ void VisualizationRenderer::render(sf::RenderTarget& target, const DSA::SortStep
     }
 }
 
-void VisualizationRenderer::setData(const void* data) {
+void VisualizationRenderer::setData(ArrayView data) {
     for (auto& component : m_components) {
         if (component && component->requiresData()) {
             component->setData(data);
@@ -41,5 +41,13 @@ void VisualizationRenderer::setData(const void* data) {
     }
 }
 
+void VisualizationRenderer::setAuxiliaryData(ArrayView data) {
+    for (auto& component : m_components) {
+        if (component && component->requiresData()) {
+            component->setAuxiliaryData(data);
+        }
+    }
+}
+
 }
 }
@@ -23,7 +23,8 @@ public:
     void updateLayout(const sf::FloatRect& bounds);
     void render(sf::RenderTarget& target, const DSA::SortStep* step) const;
     
-    void setData(const void* data);
+    void setData(ArrayView data);
+    void setAuxiliaryData(ArrayView data);
 
 private:
     std::vector<std::unique_ptr<IVisualizationComponent>> m_components;
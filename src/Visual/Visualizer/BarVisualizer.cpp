@@ -6,7 +6,7 @@ namespace DSA {
 namespace Visual {
 
 BarVisualizer::BarVisualizer()
-    : m_array(nullptr)
+    : m_array()
     , m_barWidth(20.0f)
     , m_spacing(5.0f)
     , m_baseY(600.0f)
@@ -16,17 +16,17 @@ BarVisualizer::BarVisualizer()
 {
 }
 
-void BarVisualizer::setArray(const Array& array) {
-    m_array = &array;
+void BarVisualizer::setArray(ArrayView array) {
+    m_array = array;
     m_maxValue = findMaxValue();
 }
 
 void BarVisualizer::updateLayout(const sf::FloatRect& bounds) {
-    if (!m_array || m_array->isEmpty()) {
+    if (m_array.isEmpty()) {
         return;
     }
     
-    std::size_t arraySize = m_array->size();
+    std::size_t arraySize = m_array.size();
     float availableWidth = bounds.size.x;
     float totalSpacing = (arraySize - 1) * m_spacing;
     m_barWidth = (availableWidth - totalSpacing) / static_cast<float>(arraySize);
@@ -44,12 +44,12 @@ void BarVisualizer::updateLayout(const sf::FloatRect& bounds) {
 }
 
 void BarVisualizer::render(sf::RenderTarget& target, const SortStep* step) const {
-    if (!m_array || m_array->isEmpty()) {
+    if (m_array.isEmpty()) {
         return;
     }
     
-    std::size_t size = m_array->size();
-    const Array& arrayToRender = step ? step->arrayState : *m_array;
+    std::size_t size = m_array.size();
+    ArrayView arrayToRender = m_array;
     
     for (std::size_t i = 0; i < size; ++i) {
         int value = arrayToRender[i];
@@ -165,16 +165,11 @@ sf::Color BarVisualizer::getBarColor(std::size_t index, const SortStep* step) co
 }
 
 int BarVisualizer::findMaxValue() const {
-    if (!m_array || m_array->isEmpty()) {
+    if (m_array.isEmpty()) {
         return 1;
     }
     
-    int maxVal = (*m_array)[0];
-    for (std::size_t i = 1; i < m_array->size(); ++i) {
-        if ((*m_array)[i] > maxVal) {
-            maxVal = (*m_array)[i];
-        }
-    }
+    int maxVal = m_array.minMax().second;
     
     return maxVal > 0 ? maxVal : 1;
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "DSA/Array/Array.h"
+#include "DSA/Array/ArrayView.h"
 #include "DSA/Algorithms/Sorting/SortStep.h"
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
@@ -15,12 +15,12 @@ class BarVisualizer {
 public:
     BarVisualizer();
     ~BarVisualizer() = default;
-    void setArray(const Array& array);
+    void setArray(ArrayView array);
     void updateLayout(const sf::FloatRect& bounds);
     void render(sf::RenderTarget& target, const SortStep* step = nullptr) const;
 
 private:
-    const Array* m_array;
+    ArrayView m_array;
     float m_barWidth;
     float m_spacing;
     float m_baseY;